@@ -0,0 +1,539 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Throughput of circular containers compared against std::deque and, when
+// available, boost::circular_buffer.
+//
+// Usage: circbench-container [filter]
+//
+// Only benchmarks whose name contains the filter are run. Results are written
+// to standard output as JSON in nanoseconds per operation.
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <trial/circular/span.hpp>
+#include <trial/circular/array.hpp>
+#include <trial/circular/vector.hpp>
+#if TRIAL_CIRCULAR_BENCH_BOOST
+# include <boost/circular_buffer.hpp>
+#endif
+#include "harness.hpp"
+
+using namespace trial;
+using circular::bench::do_not_optimize;
+
+namespace
+{
+
+//-----------------------------------------------------------------------------
+// Element types
+//-----------------------------------------------------------------------------
+
+struct pod64
+{
+    std::uint64_t data[8];
+};
+
+template <typename T> struct element;
+
+template <>
+struct element<int>
+{
+    static const char *name() { return "int"; }
+    static int make(std::size_t k) { return int(k); }
+    static std::size_t weight(int value) { return std::size_t(value); }
+};
+
+template <>
+struct element<double>
+{
+    static const char *name() { return "double"; }
+    static double make(std::size_t k) { return double(k); }
+    static std::size_t weight(double value) { return std::size_t(value); }
+};
+
+template <>
+struct element<pod64>
+{
+    static const char *name() { return "pod64"; }
+    static pod64 make(std::size_t k) { return { { k, k, k, k, k, k, k, k } }; }
+    static std::size_t weight(const pod64& value) { return value.data[0]; }
+};
+
+template <>
+struct element<std::string>
+{
+    static const char *name() { return "std::string"; }
+    // Longer than the small string optimization
+    static std::string make(std::size_t k) { return std::string(32 + k % 8, 'x'); }
+    static std::size_t weight(const std::string& value) { return value.size(); }
+};
+
+//-----------------------------------------------------------------------------
+// Fixtures
+//-----------------------------------------------------------------------------
+
+template <typename T>
+class span_fixture
+{
+public:
+    using value_type = T;
+    using container_type = circular::span<T>;
+
+    static const char *name() { return "circular::span"; }
+
+    explicit span_fixture(std::size_t capacity)
+        : storage(capacity),
+          data(storage.data(), storage.data() + capacity)
+    {
+    }
+
+    container_type& container() { return data; }
+
+private:
+    std::vector<T> storage;
+    container_type data;
+};
+
+template <typename T, std::size_t N>
+class array_fixture
+{
+public:
+    using value_type = T;
+    using container_type = circular::array<T, N>;
+
+    static const char *name() { return "circular::array"; }
+
+    explicit array_fixture(std::size_t) {}
+
+    container_type& container() { return data; }
+
+private:
+    container_type data;
+};
+
+template <typename T>
+class vector_fixture
+{
+public:
+    using value_type = T;
+    using container_type = circular::vector<T>;
+
+    static const char *name() { return "circular::vector"; }
+
+    explicit vector_fixture(std::size_t capacity)
+        : data(capacity)
+    {
+    }
+
+    container_type& container() { return data; }
+
+private:
+    container_type data;
+};
+
+// std::deque that evicts at the opposite end when full
+
+template <typename T>
+class bounded_deque
+{
+public:
+    using value_type = T;
+    using iterator = typename std::deque<T>::iterator;
+
+    explicit bounded_deque(std::size_t capacity) : limit(capacity) {}
+
+    std::size_t size() const { return data.size(); }
+    bool full() const { return data.size() == limit; }
+    void clear() { data.clear(); }
+    void resize(std::size_t count) { data.resize(count); }
+    const T& operator[](std::size_t index) const { return data[index]; }
+    iterator begin() { return data.begin(); }
+    iterator end() { return data.end(); }
+
+    void push_back(const T& input)
+    {
+        if (full())
+            data.pop_front();
+        data.push_back(input);
+    }
+
+    void push_front(const T& input)
+    {
+        if (full())
+            data.pop_back();
+        data.push_front(input);
+    }
+
+    void pop_front() { data.pop_front(); }
+
+private:
+    const std::size_t limit;
+    std::deque<T> data;
+};
+
+template <typename T>
+class deque_fixture
+{
+public:
+    using value_type = T;
+    using container_type = bounded_deque<T>;
+
+    static const char *name() { return "std::deque"; }
+
+    explicit deque_fixture(std::size_t capacity)
+        : data(capacity)
+    {
+    }
+
+    container_type& container() { return data; }
+
+private:
+    container_type data;
+};
+
+#if TRIAL_CIRCULAR_BENCH_BOOST
+
+template <typename T>
+class boost_fixture
+{
+public:
+    using value_type = T;
+    using container_type = boost::circular_buffer<T>;
+
+    static const char *name() { return "boost::circular_buffer"; }
+
+    explicit boost_fixture(std::size_t capacity)
+        : data(capacity)
+    {
+    }
+
+    container_type& container() { return data; }
+
+private:
+    container_type data;
+};
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Container-specific operations
+//-----------------------------------------------------------------------------
+
+template <typename Container>
+std::size_t sum_segments(Container& container)
+{
+    using traits = element<typename Container::value_type>;
+    std::size_t result = 0;
+    for (const auto& value : container.first_segment())
+        result += traits::weight(value);
+    for (const auto& value : container.last_segment())
+        result += traits::weight(value);
+    return result;
+}
+
+template <typename Container>
+void linearize(Container& container)
+{
+    container.rotate_front();
+}
+
+template <typename Container>
+void reserve_capacity(Container& container, std::size_t capacity)
+{
+    container.reserve(capacity);
+}
+
+#if TRIAL_CIRCULAR_BENCH_BOOST
+
+template <typename T>
+std::size_t sum_segments(boost::circular_buffer<T>& container)
+{
+    using traits = element<T>;
+    std::size_t result = 0;
+    auto one = container.array_one();
+    for (std::size_t k = 0; k < one.second; ++k)
+        result += traits::weight(one.first[k]);
+    auto two = container.array_two();
+    for (std::size_t k = 0; k < two.second; ++k)
+        result += traits::weight(two.first[k]);
+    return result;
+}
+
+template <typename T>
+void linearize(boost::circular_buffer<T>& container)
+{
+    container.linearize();
+}
+
+template <typename T>
+void reserve_capacity(boost::circular_buffer<T>& container, std::size_t capacity)
+{
+    container.set_capacity(capacity);
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Benchmarks
+//-----------------------------------------------------------------------------
+
+const std::size_t total_operations = 1 << 18;
+
+template <typename Fixture>
+class suite
+{
+public:
+    using value_type = typename Fixture::value_type;
+    using traits = element<value_type>;
+
+    suite(circular::bench::harness& harness, std::size_t capacity)
+        : harness(harness),
+          capacity(capacity),
+          rounds(std::max<std::size_t>(1, total_operations / capacity)),
+          fixture(capacity)
+    {
+        for (std::size_t k = 0; k < capacity; ++k)
+            values.push_back(traits::make(k));
+
+        // Pseudo-random indices from linear congruential generator
+        std::uint32_t seed = 1;
+        for (std::size_t k = 0; k < capacity; ++k)
+        {
+            seed = seed * 1664525U + 1013904223U;
+            indices.push_back(seed % capacity);
+        }
+    }
+
+    void common()
+    {
+        auto& container = fixture.container();
+
+        run("push_back", [this, &container] {
+            for (std::size_t r = 0; r < rounds; ++r)
+            {
+                container.clear();
+                for (const auto& value : values)
+                    container.push_back(value);
+            }
+            return rounds * capacity;
+        });
+
+        run("push_front", [this, &container] {
+            for (std::size_t r = 0; r < rounds; ++r)
+            {
+                container.clear();
+                for (const auto& value : values)
+                    container.push_front(value);
+            }
+            return rounds * capacity;
+        });
+
+        // Queue in steady state at half capacity
+        run("push_pop", [this, &container] {
+            container.clear();
+            for (std::size_t k = 0; k < capacity / 2; ++k)
+                container.push_back(values[k]);
+            for (std::size_t r = 0; r < rounds; ++r)
+            {
+                for (const auto& value : values)
+                {
+                    container.push_back(value);
+                    container.pop_front();
+                }
+            }
+            return rounds * capacity;
+        });
+
+        run("overwrite", [this, &container] {
+            fill();
+            for (std::size_t r = 0; r < rounds; ++r)
+            {
+                for (const auto& value : values)
+                    container.push_back(value);
+            }
+            return rounds * capacity;
+        });
+
+        fill();
+
+        run("iterate", [this, &container] {
+            for (std::size_t r = 0; r < rounds; ++r)
+            {
+                std::size_t sum = 0;
+                for (const auto& value : container)
+                    sum += traits::weight(value);
+                do_not_optimize(sum);
+            }
+            return rounds * capacity;
+        });
+
+        run("random_access", [this, &container] {
+            for (std::size_t r = 0; r < rounds; ++r)
+            {
+                std::size_t sum = 0;
+                for (auto index : indices)
+                    sum += traits::weight(container[index]);
+                do_not_optimize(sum);
+            }
+            return rounds * capacity;
+        });
+    }
+
+    void segments()
+    {
+        auto& container = fixture.container();
+        fill();
+
+        run("segments", [this, &container] {
+            for (std::size_t r = 0; r < rounds; ++r)
+            {
+                do_not_optimize(sum_segments(container));
+            }
+            return rounds * capacity;
+        });
+    }
+
+    void rotate()
+    {
+        auto& container = fixture.container();
+        fill();
+
+        // Each overwrite moves the front so every rotation does work
+        run("rotate_front", [this, &container] {
+            for (std::size_t r = 0; r < rounds; ++r)
+            {
+                container.push_back(values[r % capacity]);
+                linearize(container);
+            }
+            return rounds;
+        });
+    }
+
+    void reserve()
+    {
+        run("reserve", [this] {
+            for (std::size_t r = 0; r < rounds; ++r)
+            {
+                typename Fixture::container_type container;
+                reserve_capacity(container, capacity);
+                for (const auto& value : values)
+                    container.push_back(value);
+                do_not_optimize(container);
+            }
+            return rounds * capacity;
+        });
+    }
+
+    void resize()
+    {
+        run("resize", [this] {
+            for (std::size_t r = 0; r < rounds; ++r)
+            {
+                typename Fixture::container_type container(capacity);
+                container.resize(capacity);
+                do_not_optimize(container);
+            }
+            return rounds * capacity;
+        });
+    }
+
+private:
+    void fill()
+    {
+        auto& container = fixture.container();
+        container.clear();
+        for (const auto& value : values)
+            container.push_back(value);
+    }
+
+    template <typename Function>
+    void run(const char *name, Function&& function)
+    {
+        harness.run(name,
+                    Fixture::name(),
+                    traits::name(),
+                    capacity,
+                    std::forward<Function>(function));
+    }
+
+    circular::bench::harness& harness;
+    const std::size_t capacity;
+    const std::size_t rounds;
+    Fixture fixture;
+    std::vector<value_type> values;
+    std::vector<std::size_t> indices;
+};
+
+template <typename T, std::size_t N>
+void run_all(circular::bench::harness& harness)
+{
+    {
+        suite<span_fixture<T>> bench(harness, N);
+        bench.common();
+        bench.segments();
+        bench.rotate();
+    }
+    {
+        suite<array_fixture<T, N>> bench(harness, N);
+        bench.common();
+        bench.segments();
+        bench.rotate();
+    }
+    {
+        suite<vector_fixture<T>> bench(harness, N);
+        bench.common();
+        bench.segments();
+        bench.reserve();
+        bench.resize();
+    }
+    {
+        suite<deque_fixture<T>> bench(harness, N);
+        bench.common();
+        bench.resize();
+    }
+#if TRIAL_CIRCULAR_BENCH_BOOST
+    {
+        suite<boost_fixture<T>> bench(harness, N);
+        bench.common();
+        bench.segments();
+        bench.rotate();
+        bench.reserve();
+        bench.resize();
+    }
+#endif
+}
+
+template <typename T>
+void run_capacities(circular::bench::harness& harness)
+{
+    // Power of two and not
+    run_all<T, 1024>(harness);
+    run_all<T, 1000>(harness);
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    circular::bench::harness harness(5, (argc > 1) ? argv[1] : "");
+
+    run_capacities<int>(harness);
+    run_capacities<double>(harness);
+    run_capacities<pod64>(harness);
+    run_capacities<std::string>(harness);
+
+    harness.write(std::cout);
+    return 0;
+}
@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Throughput of finite impulse response filters.
+//
+// Usage: circbench-fir [samples [filter]]
+//
+// The circular::fir filter is measured both per sample with push() and
+// value(), and per block with process(), against the original impulse
+// example, which calculates an inner product over circular iterators for
+// each sample.
+//
+// Results are written to standard output as JSON, where an operation is one
+// filtered sample, so ops_per_s is the throughput in samples per second. The
+// capacity field is the number of coefficients.
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <trial/circular/array.hpp>
+#include <trial/circular/fir.hpp>
+#include "harness.hpp"
+
+using namespace trial;
+using circular::bench::do_not_optimize;
+
+namespace
+{
+
+// The impulse example before it used circular::fir
+
+template <typename T, std::size_t N>
+class inner_product_filter
+{
+public:
+    explicit inner_product_filter(const std::vector<T>& input)
+    {
+        std::copy(input.begin(), input.end(), coefficients.begin());
+    }
+
+    void push(T input)
+    {
+        window.push_front(input);
+    }
+
+    T value() const
+    {
+        return std::inner_product(window.begin(),
+                                  window.end(),
+                                  coefficients.begin(),
+                                  T{});
+    }
+
+private:
+    circular::array<T, N> window;
+    std::array<T, N> coefficients;
+};
+
+template <typename T>
+std::vector<T> make_coefficients(std::size_t size)
+{
+    // Windowed sinc low-pass filter
+    std::vector<T> result(size);
+    const double pi = std::acos(-1.0);
+    for (std::size_t k = 0; k < size; ++k)
+    {
+        const double x = double(k) - double(size - 1) / 2;
+        const double sinc = (x == 0.0) ? 1.0 : std::sin(0.25 * pi * x) / (0.25 * pi * x);
+        const double hann = 0.5 - 0.5 * std::cos(2 * pi * (k + 0.5) / size);
+        result[k] = T(0.25 * sinc * hann);
+    }
+    return result;
+}
+
+template <typename T, std::size_t N>
+void run(circular::bench::harness& harness,
+         const std::string& type,
+         std::size_t samples)
+{
+    const auto coefficients = make_coefficients<T>(N);
+    std::vector<T> input(samples);
+    for (std::size_t k = 0; k < samples; ++k)
+        input[k] = T(std::sin(0.01 * k) + 0.5 * std::sin(1.3 * k));
+    std::vector<T> output(samples);
+
+    harness.run("example", "inner_product", type, N, [&] {
+        inner_product_filter<T, N> filter(coefficients);
+        for (std::size_t k = 0; k < samples; ++k)
+        {
+            filter.push(input[k]);
+            output[k] = filter.value();
+        }
+        do_not_optimize(output.back());
+        return samples;
+    });
+    harness.run("push", "circular::fir", type, N, [&] {
+        circular::fir<T, N> filter(coefficients.begin(), coefficients.end());
+        for (std::size_t k = 0; k < samples; ++k)
+        {
+            filter.push(input[k]);
+            output[k] = filter.value();
+        }
+        do_not_optimize(output.back());
+        return samples;
+    });
+    for (std::size_t block : { std::size_t(64), std::size_t(1024), samples })
+    {
+        harness.run("process", "circular::fir(" + std::to_string(block) + ")", type, N, [&] {
+            circular::fir<T, N> filter(coefficients.begin(), coefficients.end());
+            for (std::size_t k = 0; k < samples; k += block)
+            {
+                filter.process(input.data() + k, output.data() + k, std::min(block, samples - k));
+            }
+            do_not_optimize(output.back());
+            return samples;
+        });
+    }
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    const std::size_t samples = (argc > 1) ? std::stoull(argv[1]) : (std::size_t(1) << 16);
+    circular::bench::harness harness(5, (argc > 2) ? argv[2] : "");
+
+    run<float, 8>(harness, "float", samples);
+    run<float, 32>(harness, "float", samples);
+    run<float, 128>(harness, "float", samples);
+    run<float, 512>(harness, "float", samples);
+    run<double, 8>(harness, "double", samples);
+    run<double, 32>(harness, "double", samples);
+    run<double, 128>(harness, "double", samples);
+    run<double, 512>(harness, "double", samples);
+
+    harness.write(std::cout);
+    return 0;
+}
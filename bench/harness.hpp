@@ -0,0 +1,137 @@
+#ifndef TRIAL_CIRCULAR_BENCH_HARNESS_HPP
+#define TRIAL_CIRCULAR_BENCH_HARNESS_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace trial
+{
+namespace circular
+{
+namespace bench
+{
+
+//! @brief Prevents the compiler from optimizing away a value.
+
+template <typename T>
+void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+//! @brief Result of a single benchmark.
+
+struct result
+{
+    std::string name;
+    std::string container;
+    std::string type;
+    std::size_t capacity;
+    std::size_t operations;
+    double nanoseconds;
+};
+
+//! @brief Runs benchmarks and collects the results.
+//!
+//! Each benchmark is repeated a number of times and the fastest repetition is
+//! reported in nanoseconds per operation and in operations per second.
+
+class harness
+{
+public:
+    explicit harness(std::size_t repetitions = 5,
+                     std::string filter = std::string())
+        : repetitions(repetitions),
+          filter(std::move(filter))
+    {
+    }
+
+    //! @brief Measures function that performs a number of operations.
+    //!
+    //! The function is called once per repetition and must return the number
+    //! of operations it performed.
+
+    template <typename Function>
+    void run(std::string name,
+             std::string container,
+             std::string type,
+             std::size_t capacity,
+             Function&& function)
+    {
+        if (!filter.empty() && name.find(filter) == std::string::npos)
+            return;
+
+        double fastest = std::numeric_limits<double>::max();
+        std::size_t operations = 0;
+        for (std::size_t k = 0; k < repetitions; ++k)
+        {
+            const auto start = clock::now();
+            operations = function();
+            const auto stop = clock::now();
+            const std::chrono::duration<double, std::nano> elapsed = stop - start;
+            if (operations > 0)
+                fastest = std::min(fastest, elapsed.count() / operations);
+        }
+        results.push_back({ std::move(name),
+                            std::move(container),
+                            std::move(type),
+                            capacity,
+                            operations,
+                            fastest });
+    }
+
+    //! @brief Writes results as JSON.
+
+    void write(std::ostream& output) const
+    {
+        output << "{\n  \"benchmarks\": [";
+        for (std::size_t k = 0; k < results.size(); ++k)
+        {
+            const auto& entry = results[k];
+            output << ((k == 0) ? "\n" : ",\n")
+                   << "    { \"name\": \"" << entry.name
+                   << "\", \"container\": \"" << entry.container
+                   << "\", \"type\": \"" << entry.type
+                   << "\", \"capacity\": " << entry.capacity
+                   << ", \"operations\": " << entry.operations
+                   << ", \"ns_per_op\": " << entry.nanoseconds
+                   << ", \"ops_per_s\": " << 1e9 / entry.nanoseconds
+                   << " }";
+        }
+        output << "\n  ]\n}\n";
+    }
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    const std::size_t repetitions;
+    const std::string filter;
+    std::vector<result> results;
+};
+
+} // namespace bench
+} // namespace circular
+} // namespace trial
+
+#endif // TRIAL_CIRCULAR_BENCH_HARNESS_HPP
@@ -0,0 +1,190 @@
+#ifndef TRIAL_CIRCULAR_BENCH_LATENCY_HPP
+#define TRIAL_CIRCULAR_BENCH_LATENCY_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <thread>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h>
+# define TRIAL_CIRCULAR_BENCH_RDTSC 1
+#else
+# define TRIAL_CIRCULAR_BENCH_RDTSC 0
+#endif
+#if defined(__linux__)
+# include <pthread.h>
+# include <sched.h>
+#endif
+
+namespace trial
+{
+namespace circular
+{
+namespace bench
+{
+
+//! @brief Low-overhead timestamps.
+//!
+//! Uses the time-stamp counter where available, and std::chrono::steady_clock
+//! otherwise. Timestamps are converted to nanoseconds with a calibrated ratio.
+
+class timestamp
+{
+public:
+    using rep = std::uint64_t;
+
+    static const char *name() noexcept
+    {
+        return TRIAL_CIRCULAR_BENCH_RDTSC ? "rdtsc" : "steady_clock";
+    }
+
+    static rep now() noexcept
+    {
+#if TRIAL_CIRCULAR_BENCH_RDTSC
+        return __rdtsc();
+#else
+        return rep(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    //! @brief Returns nanoseconds per tick.
+
+    static double calibrate()
+    {
+#if TRIAL_CIRCULAR_BENCH_RDTSC
+        using clock = std::chrono::steady_clock;
+        const auto start_time = clock::now();
+        const auto start = now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        const auto stop_time = clock::now();
+        const auto stop = now();
+        const std::chrono::duration<double, std::nano> elapsed = stop_time - start_time;
+        return elapsed.count() / double(stop - start);
+#else
+        return 1.0;
+#endif
+    }
+};
+
+//! @brief Pins current thread to processor.
+//!
+//! @returns false if pinning is unsupported or failed.
+
+inline bool pin_thread(int processor)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(processor, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)processor;
+    return false;
+#endif
+}
+
+//! @brief Log-linear histogram in the style of HdrHistogram.
+//!
+//! Values below 2^(Precision + 1) are recorded exactly. Larger values are
+//! recorded in buckets whose width doubles with each power of two, so the
+//! relative error is bounded by 2^-Precision across the entire range.
+
+template <unsigned Precision = 5>
+class latency_histogram
+{
+    static constexpr std::uint64_t sub_buckets = std::uint64_t(1) << Precision;
+
+public:
+    latency_histogram()
+        : counts((64 - Precision + 1) * sub_buckets, 0)
+    {
+    }
+
+    void clear()
+    {
+        std::fill(counts.begin(), counts.end(), 0);
+        total = 0;
+        sum = 0;
+        minimum = std::numeric_limits<std::uint64_t>::max();
+        maximum = 0;
+    }
+
+    void record(std::uint64_t value)
+    {
+        ++counts[index(value)];
+        ++total;
+        sum += double(value);
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+    }
+
+    std::uint64_t count() const { return total; }
+    std::uint64_t min() const { return (total > 0) ? minimum : 0; }
+    std::uint64_t max() const { return maximum; }
+    double mean() const { return (total > 0) ? sum / double(total) : 0.0; }
+
+    //! @brief Returns the highest value equivalent to the value at percentile.
+    //!
+    //! @pre 0 <= percentile <= 100
+
+    std::uint64_t percentile(double percentile) const
+    {
+        if (total == 0)
+            return 0;
+        const auto rank = std::max<std::uint64_t>(1, std::uint64_t(percentile / 100.0 * double(total) + 0.5));
+        std::uint64_t accumulated = 0;
+        for (std::size_t k = 0; k < counts.size(); ++k)
+        {
+            accumulated += counts[k];
+            if (accumulated >= rank)
+                return std::min(highest(k), maximum);
+        }
+        return maximum;
+    }
+
+private:
+    static std::size_t index(std::uint64_t value)
+    {
+        if (value < 2 * sub_buckets)
+            return std::size_t(value);
+        unsigned msb = 0;
+        for (auto v = value; v > 1; v >>= 1)
+            ++msb;
+        const unsigned shift = msb - Precision;
+        return std::size_t(shift * sub_buckets + (value >> shift));
+    }
+
+    static std::uint64_t highest(std::size_t index)
+    {
+        if (index < 2 * sub_buckets)
+            return index;
+        const auto shift = index / sub_buckets - 1;
+        const auto mantissa = index - shift * sub_buckets;
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+    std::vector<std::uint64_t> counts;
+    std::uint64_t total = 0;
+    double sum = 0;
+    std::uint64_t minimum = std::numeric_limits<std::uint64_t>::max();
+    std::uint64_t maximum = 0;
+};
+
+} // namespace bench
+} // namespace circular
+} // namespace trial
+
+#endif // TRIAL_CIRCULAR_BENCH_LATENCY_HPP
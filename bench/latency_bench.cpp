@@ -0,0 +1,239 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Enqueue-to-dequeue latency distribution of concurrent queues.
+//
+// Usage: circbench-latency [messages [producer-cpu consumer-cpu]]
+//
+// A producer thread sends timestamped messages in bursts to a consumer thread,
+// and waits for the consumer to receive the last message of each burst before
+// sending the next burst. Bursts larger than the queue capacity exercise the
+// full condition.
+//
+// The producer and consumer threads are pinned to the given processors if
+// specified. Results are written to standard output as JSON with latencies in
+// nanoseconds.
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <trial/circular/broadcast_ring.hpp>
+#include <trial/circular/work_stealing_deque.hpp>
+#include <concurrent/queue.hpp>
+#include "latency.hpp"
+
+using namespace trial;
+using circular::bench::timestamp;
+
+namespace
+{
+
+const std::size_t capacity = 64;
+
+struct message
+{
+    timestamp::rep stamp;
+    std::uint64_t sequence;
+};
+
+//-----------------------------------------------------------------------------
+// Queues
+//-----------------------------------------------------------------------------
+
+// Mutex-protected circular array that overwrites the oldest messages when full
+
+class example_queue
+{
+public:
+    static const char *name() { return "example::concurrent_queue"; }
+
+    void send(message input) { queue.push(input); }
+
+    bool receive(message& output)
+    {
+        output = queue.pop();
+        return true;
+    }
+
+private:
+    circular::example::concurrent_queue<message, capacity> queue;
+};
+
+class broadcast_queue
+{
+public:
+    static const char *name() { return "broadcast_ring<block>"; }
+
+    void send(message input) { ring.push(input); }
+    bool receive(message& output) { return ring.try_pop(0, output); }
+
+private:
+    circular::broadcast_ring<message> ring{ capacity, 1, circular::broadcast_policy::block };
+};
+
+class overwrite_queue
+{
+public:
+    static const char *name() { return "broadcast_ring<overwrite>"; }
+
+    void send(message input) { ring.push(input); }
+    bool receive(message& output) { return ring.try_pop(0, output); }
+
+private:
+    circular::broadcast_ring<message> ring{ capacity, 1, circular::broadcast_policy::overwrite };
+};
+
+// Producer is the owner and consumer is the thief. The deque holds pointers
+// to messages, like a task scheduler holds pointers to tasks, because larger
+// elements are not lock-free atomics. The slots are only reused after the
+// consumer has received the burst that used them.
+
+class stealing_queue
+{
+public:
+    static const char *name() { return "work_stealing_deque"; }
+
+    void send(message input)
+    {
+        auto& slot = slots[input.sequence % slots.size()];
+        slot = input;
+        deque.push_back(&slot);
+    }
+
+    bool receive(message& output)
+    {
+        message *slot = nullptr;
+        if (!deque.try_steal_front(slot))
+            return false;
+        output = *slot;
+        return true;
+    }
+
+private:
+    std::vector<message> slots = std::vector<message>(16 * capacity);
+    circular::work_stealing_deque<message *> deque{ capacity };
+};
+
+//-----------------------------------------------------------------------------
+// Measurement
+//-----------------------------------------------------------------------------
+
+struct configuration
+{
+    std::uint64_t messages;
+    int producer_cpu;
+    int consumer_cpu;
+    double ns_per_tick;
+};
+
+template <typename Queue>
+void measure(const configuration& config,
+             std::size_t burst,
+             bool& first)
+{
+    Queue queue;
+    circular::bench::latency_histogram<> histogram;
+    std::uint64_t lost = 0;
+    std::atomic<std::uint64_t> received(0);
+    const auto messages = config.messages;
+
+    std::thread consumer([&] {
+        if (config.consumer_cpu >= 0)
+            circular::bench::pin_thread(config.consumer_cpu);
+        std::uint64_t expected = 0;
+        message input;
+        std::size_t idle = 0;
+        while (expected < messages)
+        {
+            if (!queue.receive(input))
+            {
+                // Give way if the producer shares the processor
+                if (++idle % 64 == 0)
+                    std::this_thread::yield();
+                continue;
+            }
+            const auto now = timestamp::now();
+            histogram.record(std::uint64_t(double(now - input.stamp) * config.ns_per_tick));
+            lost += input.sequence - expected;
+            expected = input.sequence + 1;
+            received.store(expected, std::memory_order_release);
+        }
+    });
+
+    if (config.producer_cpu >= 0)
+        circular::bench::pin_thread(config.producer_cpu);
+    std::uint64_t sequence = 0;
+    while (sequence < messages)
+    {
+        const auto end = std::min<std::uint64_t>(sequence + burst, messages);
+        for (; sequence < end; ++sequence)
+        {
+            queue.send({ timestamp::now(), sequence });
+        }
+        // The last message of a burst is never overwritten
+        while (received.load(std::memory_order_acquire) < end)
+            std::this_thread::yield();
+    }
+    consumer.join();
+
+    std::cout << (first ? "\n" : ",\n")
+              << "    { \"queue\": \"" << Queue::name()
+              << "\", \"burst\": " << burst
+              << ", \"capacity\": " << capacity
+              << ", \"messages\": " << messages
+              << ", \"lost\": " << lost
+              << ", \"min\": " << histogram.min()
+              << ", \"mean\": " << histogram.mean()
+              << ", \"p50\": " << histogram.percentile(50.0)
+              << ", \"p90\": " << histogram.percentile(90.0)
+              << ", \"p99\": " << histogram.percentile(99.0)
+              << ", \"p99.9\": " << histogram.percentile(99.9)
+              << ", \"p99.99\": " << histogram.percentile(99.99)
+              << ", \"max\": " << histogram.max()
+              << " }";
+    first = false;
+}
+
+template <typename Queue>
+void measure_bursts(const configuration& config, bool& first)
+{
+    // Bursts below and above the queue capacity
+    for (std::size_t burst : { std::size_t(1), capacity / 2, 4 * capacity })
+    {
+        measure<Queue>(config, burst, first);
+    }
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    configuration config;
+    config.messages = (argc > 1) ? std::stoull(argv[1]) : 100000;
+    config.producer_cpu = (argc > 3) ? std::stoi(argv[2]) : -1;
+    config.consumer_cpu = (argc > 3) ? std::stoi(argv[3]) : -1;
+    config.ns_per_tick = timestamp::calibrate();
+
+    std::cout << "{\n  \"clock\": \"" << timestamp::name()
+              << "\",\n  \"pinned\": " << ((config.producer_cpu >= 0) ? "true" : "false")
+              << ",\n  \"unit\": \"ns\""
+              << ",\n  \"latency\": [";
+    bool first = true;
+    measure_bursts<example_queue>(config, first);
+    measure_bursts<broadcast_queue>(config, first);
+    measure_bursts<overwrite_queue>(config, first);
+    measure_bursts<stealing_queue>(config, first);
+    std::cout << "\n  ]\n}\n";
+    return 0;
+}
@@ -0,0 +1,168 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Scaling of parallel algorithms over a large circular vector.
+//
+// Usage: circbench-parallel [size [filter]]
+//
+// The chunked policy is measured with one thread up to the number of hardware
+// threads, and compared against the sequential standard algorithms and, when
+// enabled, the parallel standard execution policy. The container wraps around
+// its storage so both segments are used.
+//
+// Results are written to standard output as JSON in nanoseconds per element,
+// where the container field names the policy and number of threads.
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+#include <trial/circular/vector.hpp>
+#include <trial/circular/parallel.hpp>
+#include "harness.hpp"
+
+using namespace trial;
+using circular::bench::do_not_optimize;
+
+namespace
+{
+
+double square(double value)
+{
+    return value * value;
+}
+
+struct fixture
+{
+    explicit fixture(std::size_t size)
+        : data(size),
+          output(size)
+    {
+        // Overwrite a third of the elements so the container wraps around
+        for (std::size_t k = 0; k < size + size / 3; ++k)
+            data.push_back(1.0 / double(k + 1));
+    }
+
+    circular::vector<double> data;
+    std::vector<double> output;
+};
+
+void run_sequential(circular::bench::harness& harness, fixture& input)
+{
+    const auto size = input.data.size();
+    const std::string container = "sequential";
+
+    harness.run("reduce", container, "double", size, [&input, size] {
+        double sum = 0.0;
+        for (auto segment : input.data.segments())
+            sum = std::accumulate(segment.begin(), segment.end(), sum);
+        do_not_optimize(sum);
+        return size;
+    });
+    harness.run("transform_reduce", container, "double", size, [&input, size] {
+        double sum = 0.0;
+        for (auto segment : input.data.segments())
+        {
+            for (auto value : segment)
+                sum += square(value);
+        }
+        do_not_optimize(sum);
+        return size;
+    });
+    harness.run("copy", container, "double", size, [&input, size] {
+        auto where = input.output.begin();
+        for (auto segment : input.data.segments())
+            where = std::copy(segment.begin(), segment.end(), where);
+        do_not_optimize(input.output.front());
+        return size;
+    });
+}
+
+void run_chunked(circular::bench::harness& harness, fixture& input, std::size_t threads)
+{
+    const auto size = input.data.size();
+    const std::string container = "chunked_policy(" + std::to_string(threads) + ")";
+    const circular::chunked_policy policy(threads);
+
+    harness.run("reduce", container, "double", size, [&input, &policy, size] {
+        do_not_optimize(circular::reduce(policy, input.data, 0.0));
+        return size;
+    });
+    harness.run("transform_reduce", container, "double", size, [&input, &policy, size] {
+        do_not_optimize(circular::transform_reduce(policy,
+                                                   input.data,
+                                                   0.0,
+                                                   [](double lhs, double rhs) { return lhs + rhs; },
+                                                   square));
+        return size;
+    });
+    harness.run("copy", container, "double", size, [&input, &policy, size] {
+        circular::copy(policy, input.data, input.output.begin());
+        do_not_optimize(input.output.front());
+        return size;
+    });
+}
+
+#if TRIAL_CIRCULAR_EXECUTION
+
+void run_execution(circular::bench::harness& harness, fixture& input)
+{
+    const auto size = input.data.size();
+    const std::string container = "std::execution::par";
+
+    harness.run("reduce", container, "double", size, [&input, size] {
+        do_not_optimize(circular::reduce(std::execution::par, input.data, 0.0));
+        return size;
+    });
+    harness.run("transform_reduce", container, "double", size, [&input, size] {
+        do_not_optimize(circular::transform_reduce(std::execution::par,
+                                                   input.data,
+                                                   0.0,
+                                                   [](double lhs, double rhs) { return lhs + rhs; },
+                                                   square));
+        return size;
+    });
+    harness.run("copy", container, "double", size, [&input, size] {
+        circular::copy(std::execution::par, input.data, input.output.begin());
+        do_not_optimize(input.output.front());
+        return size;
+    });
+}
+
+#endif
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    const std::size_t size = (argc > 1) ? std::stoull(argv[1]) : (std::size_t(1) << 24);
+    circular::bench::harness harness(5, (argc > 2) ? argv[2] : "");
+    fixture input(size);
+
+    run_sequential(harness, input);
+
+    // Powers of two up to the number of hardware threads
+    const std::size_t hardware = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1; threads < hardware; threads *= 2)
+    {
+        run_chunked(harness, input, threads);
+    }
+    run_chunked(harness, input, hardware);
+
+#if TRIAL_CIRCULAR_EXECUTION
+    run_execution(harness, input);
+#endif
+
+    harness.write(std::cout);
+    return 0;
+}
@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <chrono>
+#include <thread>
+#include <string> // std::stoul
+#include <iostream>
+#include "scheduler.hpp"
+
+using namespace trial::circular::example;
+
+template <typename Scheduler>
+double measure(unsigned workers, task depth)
+{
+    Scheduler scheduler(workers);
+    const auto start = std::chrono::steady_clock::now();
+    const auto leaves = scheduler.run(depth);
+    const auto stop = std::chrono::steady_clock::now();
+    assert(leaves == (1UL << depth));
+    (void)leaves;
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    // Fork-join benchmark comparing work-stealing deques against a single
+    // mutex-protected circular vector. Prints the elapsed milliseconds for
+    // an increasing number of worker threads.
+
+    const task depth = (argc > 1) ? task(std::stoul(argv[1])) : 18;
+    const unsigned hardware = std::thread::hardware_concurrency();
+    const unsigned max_workers = (argc > 2)
+        ? unsigned(std::stoul(argv[2]))
+        : (hardware > 0) ? hardware : 1;
+
+    std::cout << "workers\tstealing\tmutex\n";
+    for (unsigned workers = 1; workers <= max_workers; workers *= 2)
+    {
+        std::cout << workers
+                  << '\t' << measure<stealing_scheduler>(workers, depth)
+                  << '\t' << measure<mutex_scheduler>(workers, depth)
+                  << '\n';
+    }
+    return 0;
+}
@@ -0,0 +1,190 @@
+#ifndef TRIAL_CIRCULAR_EXAMPLE_FORK_JOIN_SCHEDULER_HPP
+#define TRIAL_CIRCULAR_EXAMPLE_FORK_JOIN_SCHEDULER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <trial/circular/vector.hpp>
+#include <trial/circular/work_stealing_deque.hpp>
+
+namespace trial
+{
+namespace circular
+{
+namespace example
+{
+
+// A task is the depth of a binary tree of tasks. Executing a task with depth
+// above zero forks two tasks of the next lower depth, and executing a task
+// with depth zero performs a small amount of work.
+//
+// The schedulers run until all tasks have been executed, and return the
+// number of executed leaf tasks.
+
+using task = int;
+
+inline unsigned long leaf_work(task)
+{
+    volatile unsigned long work = 1;
+    for (unsigned k = 0; k < 64; ++k)
+        work = work * 33 + k;
+    return 1;
+}
+
+//! @brief Scheduler with one work-stealing deque per worker.
+
+class stealing_scheduler
+{
+public:
+    explicit stealing_scheduler(unsigned workers)
+    {
+        for (unsigned k = 0; k < workers; ++k)
+            deques.emplace_back(new circular::work_stealing_deque<task>());
+    }
+
+    unsigned long run(task root)
+    {
+        pending.store(1);
+        result.store(0);
+        deques.front()->push_back(root);
+
+        std::vector<std::thread> threads;
+        for (unsigned k = 1; k < deques.size(); ++k)
+            threads.emplace_back([this, k] { work(k); });
+        work(0);
+        for (auto& thread : threads)
+            thread.join();
+        return result.load();
+    }
+
+private:
+    void work(unsigned self)
+    {
+        auto& own = *deques[self];
+        unsigned long local = 0;
+        unsigned victim = self;
+        task current = 0;
+        while (pending.load(std::memory_order_acquire) > 0)
+        {
+            if (!own.try_pop_back(current))
+            {
+                // Steal from the other workers in round-robin order
+                victim = (victim + 1) % deques.size();
+                if (victim == self || !deques[victim]->try_steal_front(current))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+            }
+            if (current > 0)
+            {
+                pending.fetch_add(2, std::memory_order_relaxed);
+                own.push_back(current - 1);
+                own.push_back(current - 1);
+            }
+            else
+            {
+                local += leaf_work(current);
+            }
+            pending.fetch_sub(1, std::memory_order_release);
+        }
+        result.fetch_add(local);
+    }
+
+    std::vector<std::unique_ptr<circular::work_stealing_deque<task>>> deques;
+    std::atomic<long> pending;
+    std::atomic<unsigned long> result;
+};
+
+//! @brief Scheduler with a single mutex-protected circular vector.
+
+class mutex_scheduler
+{
+public:
+    explicit mutex_scheduler(unsigned workers)
+        : workers(workers),
+          tasks(64)
+    {
+    }
+
+    unsigned long run(task root)
+    {
+        pending.store(1);
+        result.store(0);
+        tasks.push_back(root);
+
+        std::vector<std::thread> threads;
+        for (unsigned k = 1; k < workers; ++k)
+            threads.emplace_back([this] { work(); });
+        work();
+        for (auto& thread : threads)
+            thread.join();
+        return result.load();
+    }
+
+private:
+    void work()
+    {
+        unsigned long local = 0;
+        task current = 0;
+        while (pending.load(std::memory_order_acquire) > 0)
+        {
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                if (tasks.empty())
+                {
+                    current = -1;
+                }
+                else
+                {
+                    current = tasks.pop_back();
+                }
+            }
+            if (current < 0)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            if (current > 0)
+            {
+                pending.fetch_add(2, std::memory_order_relaxed);
+                std::lock_guard<std::mutex> guard(mutex);
+                // Grow rather than overwrite the oldest tasks
+                if (tasks.size() + 2 > tasks.capacity())
+                    tasks.reserve(2 * tasks.capacity());
+                tasks.push_back(current - 1);
+                tasks.push_back(current - 1);
+            }
+            else
+            {
+                local += leaf_work(current);
+            }
+            pending.fetch_sub(1, std::memory_order_release);
+        }
+        result.fetch_add(local);
+    }
+
+    const unsigned workers;
+    std::mutex mutex;
+    circular::vector<task> tasks;
+    std::atomic<long> pending;
+    std::atomic<unsigned long> result;
+};
+
+} // namespace example
+} // namespace circular
+} // namespace trial
+
+#endif // TRIAL_CIRCULAR_EXAMPLE_FORK_JOIN_SCHEDULER_HPP
@@ -11,10 +11,9 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-#include <type_traits>
-#include <numeric>
-#include <array>
-#include <trial/circular/array.hpp>
+#include <cstddef>
+#include <utility>
+#include <trial/circular/fir.hpp>
 
 namespace trial
 {
@@ -28,16 +27,15 @@ namespace example
 template <typename T, std::size_t N>
 class impulse
 {
-    static_assert(std::is_arithmetic<T>::value, "T must be an arithmetic type");
-
 public:
     using value_type = T;
+    using size_type = std::size_t;
 
     //! @brief Creates a finite impulse filter with N entries.
 
     template <typename... Args>
     impulse(Args&&... args)
-        : coefficients{{std::forward<Args>(args)...}}
+        : filter{ value_type(std::forward<Args>(args))... }
     {
     }
 
@@ -45,22 +43,25 @@ public:
 
     void push(value_type input)
     {
-        window.push_front(input);
+        filter.push(input);
     }
 
     //! @brief Returns the filtered value.
 
     value_type value() const
     {
-        return std::inner_product(window.begin(),
-                                  window.end(),
-                                  coefficients.begin(),
-                                  value_type{});
+        return filter.value();
+    }
+
+    //! @brief Appends block of data points and writes filtered values.
+
+    void process(const value_type *input, value_type *output, size_type count)
+    {
+        filter.process(input, output, count);
     }
 
 private:
-    circular::array<value_type, N> window;
-    std::array<value_type, N> coefficients;
+    circular::fir<value_type, N> filter;
 };
 
 } // namespace example
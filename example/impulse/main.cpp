@@ -26,5 +26,14 @@ int main()
     filter.push(33.0);
     assert(filter.value() == 33.0 * 0.75 + 22.0 * 0.25);
 
+    // Blocks of data points are filtered in one call
+    const double input[] = { 44.0, 55.0, 66.0 };
+    double output[3];
+    filter.process(input, output, 3);
+    assert(output[0] == 44.0 * 0.75 + 33.0 * 0.25);
+    assert(output[1] == 55.0 * 0.75 + 44.0 * 0.25);
+    assert(output[2] == 66.0 * 0.75 + 55.0 * 0.25);
+    assert(filter.value() == output[2]);
+
     return 0;
 }
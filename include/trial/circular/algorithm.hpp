@@ -0,0 +1,84 @@
+#ifndef TRIAL_CIRCULAR_ALGORITHM_HPP
+#define TRIAL_CIRCULAR_ALGORITHM_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <utility>
+#include <trial/circular/detail/config.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+// Binary search over sorted circular containers.
+//
+// The functions operate on any circular container with segments, such as
+// span, array, and vector, and have the same semantics as their counterparts
+// in the standard library.
+//
+// The standard algorithms work with circular iterators, but each probe must
+// calculate the position of the element with modular arithmetic. Instead the
+// segment containing the searched value is selected by comparing with the
+// first element of the last segment, and the binary search is performed with
+// pointers into that segment.
+
+//! @brief Returns iterator to the first element not ordered before value.
+//!
+//! @pre Elements are partitioned with respect to compare(element, value).
+
+template <typename Circular, typename T, typename Compare>
+TRIAL_CXX20_CONSTEXPR
+auto lower_bound(Circular& buffer,
+                 const T& value,
+                 Compare compare) -> decltype(buffer.begin());
+
+template <typename Circular, typename T>
+TRIAL_CXX20_CONSTEXPR
+auto lower_bound(Circular& buffer,
+                 const T& value) -> decltype(buffer.begin());
+
+//! @brief Returns iterator to the first element ordered after value.
+//!
+//! @pre Elements are partitioned with respect to !compare(value, element).
+
+template <typename Circular, typename T, typename Compare>
+TRIAL_CXX20_CONSTEXPR
+auto upper_bound(Circular& buffer,
+                 const T& value,
+                 Compare compare) -> decltype(buffer.begin());
+
+template <typename Circular, typename T>
+TRIAL_CXX20_CONSTEXPR
+auto upper_bound(Circular& buffer,
+                 const T& value) -> decltype(buffer.begin());
+
+//! @brief Returns range of elements equivalent to value.
+//!
+//! @pre Elements are partitioned with respect to value.
+
+template <typename Circular, typename T, typename Compare>
+TRIAL_CXX20_CONSTEXPR
+auto equal_range(Circular& buffer,
+                 const T& value,
+                 Compare compare) -> std::pair<decltype(buffer.begin()), decltype(buffer.begin())>;
+
+template <typename Circular, typename T>
+TRIAL_CXX20_CONSTEXPR
+auto equal_range(Circular& buffer,
+                 const T& value) -> std::pair<decltype(buffer.begin()), decltype(buffer.begin())>;
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/algorithm.ipp>
+
+#endif // TRIAL_CIRCULAR_ALGORITHM_HPP
@@ -12,6 +12,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <array>
+#include <type_traits>
 #include <trial/circular/span.hpp>
 
 namespace trial
@@ -26,15 +27,23 @@ namespace circular
 //! Capacity is the maximum number of elements that can be inserted without
 //! overwriting old elements. Capacity cannot be changed.
 //!
+//! SizeType is the unsigned type used for sizes and indices.
+//!
+//! Policy provides hooks that are called when elements are inserted or
+//! removed.
+//!
 //! Violation of any precondition results in undefined behavior.
 
-template <typename T, std::size_t N>
+template <typename T,
+          std::size_t N,
+          typename SizeType = std::size_t,
+          typename Policy = policy::basic>
 class array
     : private std::array<T, N>,
-      private circular::span<T, N>
+      private circular::span<T, N, SizeType, Policy>
 {
     using storage = std::array<T, N>;
-    using span = circular::template span<T, N>;
+    using span = circular::template span<T, N, SizeType, Policy>;
 
     static_assert(std::is_destructible<T>::value, "T must be Erasable");
     static_assert(std::is_default_constructible<T>::value, "T must be DefaultConstructible");
@@ -52,6 +61,8 @@ public:
     using const_reverse_iterator = typename span::const_reverse_iterator;
     using segment = typename span::segment;
     using const_segment = typename span::const_segment;
+    using segment_range = typename span::segment_range;
+    using const_segment_range = typename span::const_segment_range;
 
     //! @brief Creates empty circular array.
     //!
@@ -84,7 +95,7 @@ public:
     //! @post capacity() == N
     //! @post size() == other.size()
 
-    constexpr array(array&& other) noexcept(std::is_nothrow_move_constructible<value_type>::value) = default;
+    constexpr array(array&& other) noexcept(std::is_nothrow_move_constructible<value_type>::value);
 
     //! @brief Recreates circular array by moving.
     //!
@@ -92,7 +103,7 @@ public:
     //! @post size() == other.size()
 
     TRIAL_CXX14_CONSTEXPR
-    array& operator=(array&& other) noexcept(std::is_nothrow_move_assignable<value_type>::value) = default;
+    array& operator=(array&& other) noexcept(std::is_nothrow_move_assignable<value_type>::value);
 
     //! @brief Creates circular array with element from initializer list.
     //!
@@ -152,12 +163,27 @@ public:
     //! @brief Removes and returns element at end of circular array.
     using span::push_back;
 
+    //! @brief Inserts element at beginning of circular array unless full.
+    using span::try_push_front;
+
+    //! @brief Inserts element at end of circular array unless full.
+    using span::try_push_back;
+
+    //! @brief Inserts element before position.
+    using span::insert;
+
+    //! @brief Removes elements.
+    using span::erase;
+
     //! @brief Removes and returns element from beginning of circular array.
     using span::pop_front;
 
     //! @brief Moves element from end of circular array.
     using span::pop_back;
 
+    //! @brief Rotates elements so the first element is at the beginning of the storage.
+    using span::rotate_front;
+
     //! @brief Inserts unspecified elements at beginning of circular array.
     using span::expand_front;
 
@@ -205,6 +231,15 @@ public:
 
     //! @brief Returns last contiguous unused segment of circular array.
     using span::last_unused_segment;
+
+    //! @brief Returns contiguous segments of circular array.
+    using span::segments;
+
+    //! @brief Returns statistics of the policy.
+    using span::stats;
+
+    //! @brief Returns the policy.
+    using span::get_policy;
 };
 
 } // namespace circular
@@ -0,0 +1,200 @@
+#ifndef TRIAL_CIRCULAR_BROADCAST_RING_HPP
+#define TRIAL_CIRCULAR_BROADCAST_RING_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <type_traits>
+#include <trial/circular/detail/segment.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+//! @brief Behavior of broadcast ring when the slowest reader falls behind.
+
+enum class broadcast_policy
+{
+    //! @brief Writer waits until all readers have read the oldest value.
+    block,
+    //! @brief Writer overwrites the oldest value and lagging readers skip it.
+    overwrite
+};
+
+//! @brief Single-writer multiple-reader broadcast ring.
+//!
+//! Every reader sees every value written into the ring, but each value is only
+//! written once. Readers are identified by an index and each reader has its own
+//! atomic cursor, so readers progress independently of each other.
+//!
+//! The writer is gated by the slowest reader with broadcast_policy::block.
+//! With broadcast_policy::overwrite the writer never waits, and a reader that
+//! falls more than capacity() values behind skips the overwritten values, which
+//! are counted by lag().
+//!
+//! Readers access unread values in place via at most two contiguous segments
+//! returned by peek(), and mark them as read with consume().
+//!
+//! With broadcast_policy::overwrite, the writer may overwrite a value while a
+//! reader is reading it, so the reader can observe a torn value. Like the
+//! optimistic reads of snapshot_ring, peeked values must be copied before
+//! use, and the copies are only valid if the subsequent consume() returns
+//! true. Values must therefore not be dereferenced or otherwise trusted
+//! before they have been validated. try_pop() does this automatically.
+//!
+//! All writer functions must be called from the same thread. All functions
+//! for a given reader index must be called from the same thread.
+//!
+//! @tparam T Value type, which must be trivially copyable.
+
+template <typename T>
+class broadcast_ring
+{
+    static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using sequence_type = std::uint64_t;
+    using const_segment = detail::segment<const value_type>;
+    using const_segment_range = detail::segment_range<const_segment>;
+
+    //! @brief Creates empty broadcast ring.
+    //!
+    //! @pre capacity > 0
+    //! @pre readers > 0
+
+    broadcast_ring(size_type capacity,
+                   size_type readers,
+                   broadcast_policy policy = broadcast_policy::block);
+
+    broadcast_ring(const broadcast_ring&) = delete;
+    broadcast_ring& operator=(const broadcast_ring&) = delete;
+
+    //! @brief Returns the maximum number of unread values per reader.
+
+    size_type capacity() const noexcept;
+
+    //! @brief Returns the number of readers.
+
+    size_type readers() const noexcept;
+
+    //! @brief Returns the policy.
+
+    broadcast_policy policy() const noexcept;
+
+    //! @brief Returns the number of values written.
+
+    sequence_type sequence() const noexcept;
+
+    // Writer
+
+    //! @brief Appends value if possible.
+    //!
+    //! Always succeeds with broadcast_policy::overwrite.
+    //!
+    //! @returns false if the slowest reader has capacity() unread values.
+
+    bool try_push(value_type input) noexcept;
+
+    //! @brief Appends value.
+    //!
+    //! Yields until the slowest reader has read enough values.
+
+    void push(value_type input) noexcept;
+
+    // Reader
+
+    //! @brief Returns the number of unread values of reader.
+    //!
+    //! @pre reader < readers()
+
+    size_type available(size_type reader) const noexcept;
+
+    //! @brief Returns the unread values of reader as contiguous segments.
+    //!
+    //! With broadcast_policy::overwrite, values that have been overwritten
+    //! since the last call are skipped and added to lag(). The returned
+    //! values may be overwritten while being read, so they must be
+    //! validated with consume() before use.
+    //!
+    //! At most capacity() values are returned.
+    //!
+    //! @pre reader < readers()
+
+    const_segment_range peek(size_type reader) noexcept;
+
+    //! @brief Marks the oldest unread values of reader as read.
+    //!
+    //! With broadcast_policy::overwrite, the writer may have overwritten
+    //! peeked values while they were being read. The values must then be
+    //! discarded and peeked again.
+    //!
+    //! @pre reader < readers()
+    //! @pre count <= number of values in last peek(reader)
+    //! @returns false if the values were overwritten while being read.
+
+    bool consume(size_type reader, size_type count) noexcept;
+
+    //! @brief Removes oldest unread value of reader.
+    //!
+    //! @pre reader < readers()
+    //! @returns true if a value was removed into output, false if none.
+
+    bool try_pop(size_type reader, value_type& output) noexcept;
+
+    //! @brief Returns the number of values skipped by reader.
+    //!
+    //! Always zero with broadcast_policy::block.
+    //!
+    //! @pre reader < readers()
+
+    sequence_type lag(size_type reader) const noexcept;
+
+private:
+    sequence_type oldest() const noexcept;
+    sequence_type slowest() const noexcept;
+
+    // Cursors are padded to separate cache lines to avoid false sharing
+    // between readers.
+    struct cursor_type
+    {
+        std::atomic<sequence_type> position;
+        sequence_type lag;
+        char padding[64 - 2 * sizeof(sequence_type)];
+    };
+
+    struct
+    {
+        const broadcast_policy policy;
+        const size_type readers;
+        std::vector<value_type> storage;
+        std::unique_ptr<cursor_type[]> cursors;
+        // Cached position of the slowest reader
+        sequence_type gate;
+        // Position after the value being written
+        std::atomic<sequence_type> claim;
+        // Position after the last published value
+        std::atomic<sequence_type> head;
+    } member;
+};
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/broadcast_ring.ipp>
+
+#endif // TRIAL_CIRCULAR_BROADCAST_RING_HPP
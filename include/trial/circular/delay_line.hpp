@@ -0,0 +1,209 @@
+#ifndef TRIAL_CIRCULAR_DELAY_LINE_HPP
+#define TRIAL_CIRCULAR_DELAY_LINE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <type_traits>
+#include <trial/circular/array.hpp>
+
+namespace trial
+{
+namespace circular
+{
+namespace interpolation
+{
+
+//! @brief Linear interpolation between two neighbouring samples.
+
+struct linear
+{
+    //! @brief Number of samples used for interpolation.
+    static constexpr std::size_t points = 2;
+
+    //! @brief Number of samples with shorter delay than the fractional delay.
+    static constexpr std::size_t offset = 0;
+
+    //! @brief Calculates weights of samples at distance from first sample.
+    template <typename Real>
+    static void weights(Real distance, Real *output) noexcept;
+};
+
+//! @brief Lagrange interpolation of given order.
+//!
+//! The Order + 1 samples surrounding the fractional delay are used, so the
+//! fractional delay is as central as possible.
+
+template <std::size_t Order = 3>
+struct lagrange
+{
+    static_assert(Order > 0, "Order must be greater than zero");
+
+    //! @brief Number of samples used for interpolation.
+    static constexpr std::size_t points = Order + 1;
+
+    //! @brief Number of samples with shorter delay than the fractional delay.
+    static constexpr std::size_t offset = (Order - 1) / 2;
+
+    //! @brief Calculates weights of samples at distance from first sample.
+    template <typename Real>
+    static void weights(Real distance, Real *output) noexcept;
+};
+
+} // namespace interpolation
+
+//! @brief Delay line with the N most recent samples.
+//!
+//! The delay line is always full, and initially contains value-initialized
+//! samples. Delays are counted from the newest sample, so tap(0) returns the
+//! most recently pushed sample and tap(N - 1) the oldest.
+//!
+//! Taps are read directly from the contiguous segments of the underlying
+//! circular array, which avoids the index calculation of operator[]. Blocks
+//! of samples are processed segment by segment, so the index calculation is
+//! done once per block.
+
+template <typename T, std::size_t N>
+class delay_line
+{
+    static_assert(N > 0, "N must be greater than zero");
+
+    using window_type = circular::array<T, N>;
+
+public:
+    using value_type = typename window_type::value_type;
+    using size_type = typename window_type::size_type;
+    using const_reference = typename window_type::const_reference;
+    using const_iterator = typename window_type::const_iterator;
+
+    //! @brief Creates delay line with value-initialized samples.
+
+    delay_line() noexcept(std::is_nothrow_default_constructible<value_type>::value);
+
+    //! @brief Returns the number of samples in delay line.
+
+    constexpr size_type size() const noexcept;
+
+    //! @brief Returns the maximum number of samples in delay line.
+
+    constexpr size_type capacity() const noexcept;
+
+    //! @brief Resets all samples to value-initialized samples.
+
+    void clear() noexcept(std::is_nothrow_default_constructible<value_type>::value);
+
+    //! @brief Appends sample and evicts the oldest sample.
+
+    void push(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Returns sample at integer delay.
+    //!
+    //! @pre delay < capacity()
+
+    const_reference tap(size_type delay) const noexcept;
+
+    //! @brief Returns interpolated sample at fractional delay.
+    //!
+    //! The samples surrounding the delay are combined with the weights of
+    //! the Interpolation method, such as interpolation::linear or
+    //! interpolation::lagrange<3>.
+    //!
+    //! @pre delay >= 0
+    //! @pre All samples used by the interpolation are within the delay line.
+
+    template <typename Real, typename Interpolation>
+    value_type tap(Real delay, Interpolation) const noexcept;
+
+    //! @brief Writes samples at integer delays to output.
+    //!
+    //! @returns Iterator past the last written sample.
+
+    template <typename InputIterator, typename OutputIterator>
+    OutputIterator taps(InputIterator first,
+                        InputIterator last,
+                        OutputIterator output) const;
+
+    //! @brief Writes interpolated samples at fractional delays to output.
+    //!
+    //! @returns Iterator past the last written sample.
+
+    template <typename InputIterator, typename OutputIterator, typename Interpolation>
+    OutputIterator taps(InputIterator first,
+                        InputIterator last,
+                        OutputIterator output,
+                        Interpolation) const;
+
+    //! @brief Appends block of samples and writes delayed samples to output.
+    //!
+    //! Equivalent to a push of each input sample followed by a tap at delay,
+    //! but with contiguous copies. Input and output may be the same.
+    //!
+    //! @pre delay < capacity()
+
+    void process(const value_type *input,
+                 value_type *output,
+                 size_type count,
+                 size_type delay);
+
+    //! @brief Appends block of samples and writes interpolated samples to output.
+    //!
+    //! Equivalent to a push of each input sample followed by a tap at
+    //! fractional delay. The interpolation weights are calculated once per
+    //! block. Input and output may be the same.
+    //!
+    //! @pre delay >= 0
+    //! @pre All samples used by the interpolation are within the delay line.
+
+    template <typename Real, typename Interpolation>
+    void process(const value_type *input,
+                 value_type *output,
+                 size_type count,
+                 Real delay,
+                 Interpolation);
+
+    //! @brief Returns iterator to the oldest sample.
+
+    const_iterator begin() const noexcept;
+
+    //! @brief Returns iterator to the ending of the delay line.
+
+    const_iterator end() const noexcept;
+
+private:
+    using const_segment = typename window_type::const_segment;
+
+    static const_reference at(const const_segment& first,
+                              const const_segment& last,
+                              size_type delay) noexcept;
+
+    template <typename Real, typename Interpolation>
+    static value_type interpolate(const const_segment& first,
+                                  const const_segment& last,
+                                  Real delay) noexcept;
+
+    template <typename Real, typename Interpolation>
+    static size_type base(Real delay) noexcept;
+
+    void write(const value_type *input, size_type count);
+
+    template <typename Function>
+    void visit(size_type position, size_type count, Function&& function) const;
+
+private:
+    window_type window;
+};
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/delay_line.ipp>
+
+#endif // TRIAL_CIRCULAR_DELAY_LINE_HPP
@@ -0,0 +1,101 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstddef>
+
+namespace trial
+{
+namespace circular
+{
+namespace detail
+{
+
+struct less
+{
+    template <typename T, typename U>
+    constexpr bool operator()(const T& lhs, const U& rhs) const
+    {
+        return lhs < rhs;
+    }
+};
+
+} // namespace detail
+
+template <typename Circular, typename T, typename Compare>
+TRIAL_CXX20_CONSTEXPR
+auto lower_bound(Circular& buffer,
+                 const T& value,
+                 Compare compare) -> decltype(buffer.begin())
+{
+    const auto first = buffer.first_segment();
+    const auto last = buffer.last_segment();
+    if ((last.size() > 0) && compare(*last.begin(), value))
+    {
+        const auto where = std::lower_bound(last.begin(), last.end(), value, compare);
+        return buffer.begin() + (std::ptrdiff_t(first.size()) + (where - last.begin()));
+    }
+    const auto where = std::lower_bound(first.begin(), first.end(), value, compare);
+    return buffer.begin() + (where - first.begin());
+}
+
+template <typename Circular, typename T>
+TRIAL_CXX20_CONSTEXPR
+auto lower_bound(Circular& buffer,
+                 const T& value) -> decltype(buffer.begin())
+{
+    return circular::lower_bound(buffer, value, detail::less{});
+}
+
+template <typename Circular, typename T, typename Compare>
+TRIAL_CXX20_CONSTEXPR
+auto upper_bound(Circular& buffer,
+                 const T& value,
+                 Compare compare) -> decltype(buffer.begin())
+{
+    const auto first = buffer.first_segment();
+    const auto last = buffer.last_segment();
+    if ((last.size() > 0) && !compare(value, *last.begin()))
+    {
+        const auto where = std::upper_bound(last.begin(), last.end(), value, compare);
+        return buffer.begin() + (std::ptrdiff_t(first.size()) + (where - last.begin()));
+    }
+    const auto where = std::upper_bound(first.begin(), first.end(), value, compare);
+    return buffer.begin() + (where - first.begin());
+}
+
+template <typename Circular, typename T>
+TRIAL_CXX20_CONSTEXPR
+auto upper_bound(Circular& buffer,
+                 const T& value) -> decltype(buffer.begin())
+{
+    return circular::upper_bound(buffer, value, detail::less{});
+}
+
+template <typename Circular, typename T, typename Compare>
+TRIAL_CXX20_CONSTEXPR
+auto equal_range(Circular& buffer,
+                 const T& value,
+                 Compare compare) -> std::pair<decltype(buffer.begin()), decltype(buffer.begin())>
+{
+    return std::make_pair(circular::lower_bound(buffer, value, compare),
+                          circular::upper_bound(buffer, value, compare));
+}
+
+template <typename Circular, typename T>
+TRIAL_CXX20_CONSTEXPR
+auto equal_range(Circular& buffer,
+                 const T& value) -> std::pair<decltype(buffer.begin()), decltype(buffer.begin())>
+{
+    return circular::equal_range(buffer, value, detail::less{});
+}
+
+} // namespace circular
+} // namespace trial
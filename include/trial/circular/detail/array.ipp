@@ -13,15 +13,32 @@ namespace trial
 namespace circular
 {
 
-template <typename T, std::size_t N>
-constexpr array<T, N>::array() noexcept
+// Constant evaluation requires initialized elements. C++17 can only do this by
+// value-initializing the storage, which zeroes trivial elements at runtime as
+// well, so the other standards leave the storage default-initialized.
+template <typename T, std::size_t N, typename S, typename P>
+constexpr array<T, N, S, P>::array() noexcept
+#if __cplusplus >= 201703L && __cplusplus < 202002L
+    : storage(),
+      span(storage::begin(), storage::end())
+#else
     : span(storage::begin(), storage::end())
+#endif
 {
+#if __cplusplus >= 202002L
+    if constexpr (std::is_trivially_default_constructible<value_type>::value)
+    {
+        if (std::is_constant_evaluated())
+        {
+            storage::fill(value_type{});
+        }
+    }
+#endif
 }
 
 // Custom copy constructor is needed to set span pointer correctly.
-template <typename T, std::size_t N>
-constexpr array<T, N>::array(const array& other) noexcept(std::is_nothrow_copy_constructible<value_type>::value)
+template <typename T, std::size_t N, typename S, typename P>
+constexpr array<T, N, S, P>::array(const array& other) noexcept(std::is_nothrow_copy_constructible<value_type>::value)
     : storage(static_cast<const storage&>(other)),
       span(static_cast<const span&>(other), &*storage::begin())
 {
@@ -29,9 +46,9 @@ constexpr array<T, N>::array(const array& other) noexcept(std::is_nothrow_copy_c
 }
 
 // Custom copy assignment is needed to set span pointer correctly.
-template <typename T, std::size_t N>
+template <typename T, std::size_t N, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto array<T, N>::operator=(const array& other) noexcept(std::is_nothrow_copy_assignable<value_type>::value) -> array&
+auto array<T, N, S, P>::operator=(const array& other) noexcept(std::is_nothrow_copy_assignable<value_type>::value) -> array&
 {
     static_assert(std::is_copy_assignable<T>::value, "Copy assignment only usable when T is copy assignable");
 
@@ -40,25 +57,43 @@ auto array<T, N>::operator=(const array& other) noexcept(std::is_nothrow_copy_as
     return *this;
 }
 
+// Custom move constructor is needed to set span pointer correctly.
+template <typename T, std::size_t N, typename S, typename P>
+constexpr array<T, N, S, P>::array(array&& other) noexcept(std::is_nothrow_move_constructible<value_type>::value)
+    : storage(static_cast<storage&&>(other)),
+      span(static_cast<const span&>(other), &*storage::begin())
+{
+}
+
+// Custom move assignment is needed to set span pointer correctly.
+template <typename T, std::size_t N, typename S, typename P>
+TRIAL_CXX14_CONSTEXPR
+auto array<T, N, S, P>::operator=(array&& other) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> array&
+{
+    storage::operator=(static_cast<storage&&>(other));
+    span::assign(static_cast<const span&>(other), &*storage::begin());
+    return *this;
+}
+
 // Emulates aggregate construction
-template <typename T, std::size_t N>
+template <typename T, std::size_t N, typename S, typename P>
 template <typename... Args>
-constexpr array<T, N>::array(value_type arg1, Args&&... args) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+constexpr array<T, N, S, P>::array(value_type arg1, Args&&... args) noexcept(std::is_nothrow_move_assignable<value_type>::value)
     : storage{std::move(arg1), std::forward<decltype(args)>(args)...},
       span(storage::begin(), storage::end(), storage::begin(), 1 + sizeof...(args))
 {
 }
 
-template <typename T, std::size_t N>
+template <typename T, std::size_t N, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto array<T, N>::operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> array&
+auto array<T, N, S, P>::operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> array&
 {
     span::operator=(std::move(input));
     return *this;
 }
 
-template <typename T, std::size_t N>
-constexpr auto array<T, N>::max_size() const noexcept -> size_type
+template <typename T, std::size_t N, typename S, typename P>
+constexpr auto array<T, N, S, P>::max_size() const noexcept -> size_type
 {
     return capacity();
 }
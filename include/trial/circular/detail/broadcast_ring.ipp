@@ -0,0 +1,209 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <algorithm>
+#include <thread>
+
+namespace trial
+{
+namespace circular
+{
+
+template <typename T>
+broadcast_ring<T>::broadcast_ring(size_type capacity,
+                                  size_type readers,
+                                  broadcast_policy policy)
+    : member{ policy,
+              readers,
+              std::vector<value_type>(capacity),
+              std::unique_ptr<cursor_type[]>(new cursor_type[readers]),
+              0,
+              {0},
+              {0} }
+{
+    assert(capacity > 0);
+    assert(readers > 0);
+
+    for (size_type k = 0; k < readers; ++k)
+    {
+        member.cursors[k].position.store(0, std::memory_order_relaxed);
+        member.cursors[k].lag = 0;
+    }
+}
+
+template <typename T>
+auto broadcast_ring<T>::capacity() const noexcept -> size_type
+{
+    return member.storage.size();
+}
+
+template <typename T>
+auto broadcast_ring<T>::readers() const noexcept -> size_type
+{
+    return member.readers;
+}
+
+template <typename T>
+auto broadcast_ring<T>::policy() const noexcept -> broadcast_policy
+{
+    return member.policy;
+}
+
+template <typename T>
+auto broadcast_ring<T>::sequence() const noexcept -> sequence_type
+{
+    return member.head.load(std::memory_order_acquire);
+}
+
+template <typename T>
+bool broadcast_ring<T>::try_push(value_type input) noexcept
+{
+    const auto head = member.head.load(std::memory_order_relaxed);
+
+    if (member.policy == broadcast_policy::block)
+    {
+        // Only scan the reader cursors when the cached gate is exhausted
+        if (head - member.gate >= capacity())
+        {
+            member.gate = slowest();
+            if (head - member.gate >= capacity())
+                return false;
+        }
+    }
+    else
+    {
+        // Announce the overwrite before modifying the storage so readers can
+        // detect that their values are being overwritten
+        member.claim.store(head + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    member.storage[head % capacity()] = input;
+    member.head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+void broadcast_ring<T>::push(value_type input) noexcept
+{
+    while (!try_push(input))
+    {
+        std::this_thread::yield();
+    }
+}
+
+template <typename T>
+auto broadcast_ring<T>::available(size_type reader) const noexcept -> size_type
+{
+    assert(reader < readers());
+
+    const auto position = member.cursors[reader].position.load(std::memory_order_relaxed);
+    const auto head = member.head.load(std::memory_order_acquire);
+    return size_type(std::min<sequence_type>(head - position, capacity()));
+}
+
+template <typename T>
+auto broadcast_ring<T>::peek(size_type reader) noexcept -> const_segment_range
+{
+    assert(reader < readers());
+
+    auto& cursor = member.cursors[reader];
+    auto position = cursor.position.load(std::memory_order_relaxed);
+
+    if (member.policy == broadcast_policy::overwrite)
+    {
+        // Claim is loaded before head, so oldest() cannot pass head
+        const auto first = oldest();
+        if (position < first)
+        {
+            cursor.lag += first - position;
+            position = first;
+            cursor.position.store(position, std::memory_order_release);
+        }
+    }
+
+    // The writer may have advanced after the overwrite check, so the length
+    // is clamped to the storage. Values that are overwritten while being
+    // read are detected by consume().
+    const auto head = member.head.load(std::memory_order_acquire);
+    const auto length = size_type(std::min<sequence_type>(head - position, capacity()));
+    const auto index = size_type(position % capacity());
+    const auto first_length = std::min(length, capacity() - index);
+    const value_type *data = member.storage.data();
+    return const_segment_range(const_segment(data + index, first_length),
+                               const_segment(data, length - first_length));
+}
+
+template <typename T>
+bool broadcast_ring<T>::consume(size_type reader, size_type count) noexcept
+{
+    assert(reader < readers());
+
+    auto& cursor = member.cursors[reader];
+    const auto position = cursor.position.load(std::memory_order_relaxed);
+    assert(count <= member.head.load(std::memory_order_relaxed) - position);
+
+    if (member.policy == broadcast_policy::overwrite)
+    {
+        // The oldest peeked value is overwritten first
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (member.claim.load(std::memory_order_relaxed) > position + capacity())
+            return false;
+    }
+
+    cursor.position.store(position + count, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool broadcast_ring<T>::try_pop(size_type reader, value_type& output) noexcept
+{
+    assert(reader < readers());
+
+    for (;;)
+    {
+        auto range = peek(reader);
+        if (range.empty())
+            return false;
+        output = *range.begin()->begin();
+        if (consume(reader, 1))
+            return true;
+    }
+}
+
+template <typename T>
+auto broadcast_ring<T>::lag(size_type reader) const noexcept -> sequence_type
+{
+    assert(reader < readers());
+
+    return member.cursors[reader].lag;
+}
+
+template <typename T>
+auto broadcast_ring<T>::oldest() const noexcept -> sequence_type
+{
+    const auto claim = member.claim.load(std::memory_order_acquire);
+    return (claim > capacity()) ? claim - capacity() : 0;
+}
+
+template <typename T>
+auto broadcast_ring<T>::slowest() const noexcept -> sequence_type
+{
+    auto result = member.cursors[0].position.load(std::memory_order_acquire);
+    for (size_type k = 1; k < readers(); ++k)
+    {
+        result = std::min(result, member.cursors[k].position.load(std::memory_order_acquire));
+    }
+    return result;
+}
+
+} // namespace circular
+} // namespace trial
@@ -17,6 +17,32 @@
 # define TRIAL_CIRCULAR_CXX14(x)
 #endif
 
+#if __cplusplus >= 201703L
+# define TRIAL_CIRCULAR_CXX17(x) x
+#else
+# define TRIAL_CIRCULAR_CXX17(x)
+#endif
+
+#if __cplusplus >= 202002L
+# define TRIAL_CIRCULAR_CXX20(x) x
+#else
+# define TRIAL_CIRCULAR_CXX20(x)
+#endif
+
 #define TRIAL_CXX14_CONSTEXPR TRIAL_CIRCULAR_CXX14(constexpr)
+#define TRIAL_CXX17_CONSTEXPR TRIAL_CIRCULAR_CXX17(constexpr)
+#define TRIAL_CXX20_CONSTEXPR TRIAL_CIRCULAR_CXX20(constexpr)
+
+#if __cplusplus >= 202002L && defined(__has_include)
+# if __has_include(<ranges>)
+#  include <ranges>
+# endif
+#endif
+
+#if defined(__cpp_lib_ranges) && defined(__cpp_concepts)
+# define TRIAL_CIRCULAR_RANGES 1
+#else
+# define TRIAL_CIRCULAR_RANGES 0
+#endif
 
 #endif // TRIAL_CIRCULAR_DETAIL_CONFIG_HPP
@@ -0,0 +1,336 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+namespace trial
+{
+namespace circular
+{
+namespace interpolation
+{
+
+//-----------------------------------------------------------------------------
+// linear
+//-----------------------------------------------------------------------------
+
+constexpr std::size_t linear::points;
+constexpr std::size_t linear::offset;
+
+template <typename Real>
+void linear::weights(Real distance, Real *output) noexcept
+{
+    output[0] = Real(1) - distance;
+    output[1] = distance;
+}
+
+//-----------------------------------------------------------------------------
+// lagrange
+//-----------------------------------------------------------------------------
+
+template <std::size_t Order>
+constexpr std::size_t lagrange<Order>::points;
+
+template <std::size_t Order>
+constexpr std::size_t lagrange<Order>::offset;
+
+template <std::size_t Order>
+template <typename Real>
+void lagrange<Order>::weights(Real distance, Real *output) noexcept
+{
+    // Lagrange basis polynomials for the samples at distance 0, 1, ..., Order
+    for (std::size_t k = 0; k < points; ++k)
+    {
+        Real weight(1);
+        for (std::size_t j = 0; j < points; ++j)
+        {
+            if (j != k)
+                weight *= (distance - Real(j)) / (Real(k) - Real(j));
+        }
+        output[k] = weight;
+    }
+}
+
+} // namespace interpolation
+
+//-----------------------------------------------------------------------------
+// delay_line
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+delay_line<T, N>::delay_line() noexcept(std::is_nothrow_default_constructible<value_type>::value)
+{
+    window.expand_back(N);
+    clear();
+}
+
+template <typename T, std::size_t N>
+constexpr auto delay_line<T, N>::size() const noexcept -> size_type
+{
+    return N;
+}
+
+template <typename T, std::size_t N>
+constexpr auto delay_line<T, N>::capacity() const noexcept -> size_type
+{
+    return N;
+}
+
+template <typename T, std::size_t N>
+void delay_line<T, N>::clear() noexcept(std::is_nothrow_default_constructible<value_type>::value)
+{
+    for (auto segment : window.segments())
+    {
+        std::fill(segment.begin(), segment.end(), value_type{});
+    }
+}
+
+template <typename T, std::size_t N>
+void delay_line<T, N>::push(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+{
+    window.push_back(std::move(input));
+}
+
+template <typename T, std::size_t N>
+auto delay_line<T, N>::tap(size_type delay) const noexcept -> const_reference
+{
+    assert(delay < N);
+
+    return at(window.first_segment(), window.last_segment(), delay);
+}
+
+template <typename T, std::size_t N>
+template <typename Real, typename Interpolation>
+auto delay_line<T, N>::tap(Real delay, Interpolation) const noexcept -> value_type
+{
+    return interpolate<Real, Interpolation>(window.first_segment(),
+                                            window.last_segment(),
+                                            delay);
+}
+
+template <typename T, std::size_t N>
+template <typename InputIterator, typename OutputIterator>
+OutputIterator delay_line<T, N>::taps(InputIterator first,
+                                      InputIterator last,
+                                      OutputIterator output) const
+{
+    // The segments are located once for all taps
+    const auto head = window.first_segment();
+    const auto tail = window.last_segment();
+    for (; first != last; ++first)
+    {
+        assert(size_type(*first) < N);
+        *output = at(head, tail, *first);
+        ++output;
+    }
+    return output;
+}
+
+template <typename T, std::size_t N>
+template <typename InputIterator, typename OutputIterator, typename Interpolation>
+OutputIterator delay_line<T, N>::taps(InputIterator first,
+                                      InputIterator last,
+                                      OutputIterator output,
+                                      Interpolation) const
+{
+    using real_type = typename std::decay<decltype(*first)>::type;
+
+    const auto head = window.first_segment();
+    const auto tail = window.last_segment();
+    for (; first != last; ++first)
+    {
+        *output = interpolate<real_type, Interpolation>(head, tail, *first);
+        ++output;
+    }
+    return output;
+}
+
+template <typename T, std::size_t N>
+void delay_line<T, N>::process(const value_type *input,
+                               value_type *output,
+                               size_type count,
+                               size_type delay)
+{
+    assert(delay < N);
+
+    // Each chunk is written before the delayed samples are read, so the
+    // chunk cannot be longer than the samples not covered by the delay.
+    const size_type limit = N - delay;
+    while (count > 0)
+    {
+        const size_type chunk = std::min(count, limit);
+        write(input, chunk);
+        visit(N - chunk - delay,
+              chunk,
+              [output] (const value_type *data, size_type size, size_type offset)
+              {
+                  std::copy(data, data + size, output + offset);
+              });
+        input += chunk;
+        output += chunk;
+        count -= chunk;
+    }
+}
+
+template <typename T, std::size_t N>
+template <typename Real, typename Interpolation>
+void delay_line<T, N>::process(const value_type *input,
+                               value_type *output,
+                               size_type count,
+                               Real delay,
+                               Interpolation)
+{
+    const size_type first = base<Real, Interpolation>(delay);
+    assert(first + Interpolation::points <= N);
+
+    Real weights[Interpolation::points];
+    Interpolation::weights(Real(delay - Real(first)), weights);
+
+    const size_type limit = N + 1 - first - Interpolation::points;
+    while (count > 0)
+    {
+        const size_type chunk = std::min(count, limit);
+        write(input, chunk);
+        std::fill(output, output + chunk, value_type{});
+        // Accumulate one weighted and contiguous run of samples at a time
+        for (size_type k = 0; k < Interpolation::points; ++k)
+        {
+            const Real weight = weights[k];
+            visit(N - chunk - first - k,
+                  chunk,
+                  [output, weight] (const value_type *data, size_type size, size_type offset)
+                  {
+                      value_type *target = output + offset;
+                      for (size_type j = 0; j < size; ++j)
+                      {
+                          target[j] += value_type(weight * data[j]);
+                      }
+                  });
+        }
+        input += chunk;
+        output += chunk;
+        count -= chunk;
+    }
+}
+
+template <typename T, std::size_t N>
+auto delay_line<T, N>::begin() const noexcept -> const_iterator
+{
+    return window.begin();
+}
+
+template <typename T, std::size_t N>
+auto delay_line<T, N>::end() const noexcept -> const_iterator
+{
+    return window.end();
+}
+
+template <typename T, std::size_t N>
+auto delay_line<T, N>::at(const const_segment& first,
+                          const const_segment& last,
+                          size_type delay) noexcept -> const_reference
+{
+    // The delay line is full, so the newest sample is at position N - 1
+    const size_type position = N - 1 - delay;
+    return (position < first.size())
+        ? first.data()[position]
+        : last.data()[position - first.size()];
+}
+
+template <typename T, std::size_t N>
+template <typename Real, typename Interpolation>
+auto delay_line<T, N>::interpolate(const const_segment& first,
+                                   const const_segment& last,
+                                   Real delay) noexcept -> value_type
+{
+    const size_type lower = base<Real, Interpolation>(delay);
+    assert(lower + Interpolation::points <= N);
+
+    Real weights[Interpolation::points];
+    Interpolation::weights(Real(delay - Real(lower)), weights);
+
+    value_type result{};
+    for (size_type k = 0; k < Interpolation::points; ++k)
+    {
+        result += value_type(weights[k] * at(first, last, lower + k));
+    }
+    return result;
+}
+
+template <typename T, std::size_t N>
+template <typename Real, typename Interpolation>
+auto delay_line<T, N>::base(Real delay) noexcept -> size_type
+{
+    static_assert(std::is_floating_point<Real>::value, "Real must be a floating-point type");
+    assert(delay >= Real(0));
+
+    // Delay of the first sample used by the interpolation
+    const size_type whole = size_type(delay);
+    return (whole > Interpolation::offset) ? whole - Interpolation::offset : 0;
+}
+
+template <typename T, std::size_t N>
+void delay_line<T, N>::write(const value_type *input, size_type count)
+{
+    assert(count <= N);
+
+    // Overwrite the oldest samples and copy input into the newest positions
+    window.expand_back(count);
+    auto first = window.first_segment();
+    auto last = window.last_segment();
+    size_type position = N - count;
+    if (position < first.size())
+    {
+        const size_type amount = std::min(count, first.size() - position);
+        std::copy(input, input + amount, first.data() + position);
+        input += amount;
+        count -= amount;
+        position = 0;
+    }
+    else
+    {
+        position -= first.size();
+    }
+    std::copy(input, input + count, last.data() + position);
+}
+
+template <typename T, std::size_t N>
+template <typename Function>
+void delay_line<T, N>::visit(size_type position,
+                             size_type count,
+                             Function&& function) const
+{
+    // Calls function with the contiguous pieces of [position, position + count)
+    const auto first = window.first_segment();
+    const auto last = window.last_segment();
+    size_type offset = 0;
+    if (position < first.size())
+    {
+        const size_type amount = std::min(count, first.size() - position);
+        function(first.data() + position, amount, offset);
+        offset += amount;
+        count -= amount;
+        position = 0;
+    }
+    else
+    {
+        position -= first.size();
+    }
+    if (count > 0)
+    {
+        function(last.data() + position, count, offset);
+    }
+}
+
+} // namespace circular
+} // namespace trial
@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+
+namespace trial
+{
+namespace circular
+{
+
+template <typename T, std::size_t N, typename C>
+extremum<T, N, C>::extremum(const value_compare& compare)
+    : compare(compare)
+{
+}
+
+template <typename T, std::size_t N, typename C>
+bool extremum<T, N, C>::empty() const noexcept
+{
+    return window.empty();
+}
+
+template <typename T, std::size_t N, typename C>
+bool extremum<T, N, C>::full() const noexcept
+{
+    return window.full();
+}
+
+template <typename T, std::size_t N, typename C>
+auto extremum<T, N, C>::size() const noexcept -> size_type
+{
+    return window.size();
+}
+
+template <typename T, std::size_t N, typename C>
+constexpr auto extremum<T, N, C>::capacity() const noexcept -> size_type
+{
+    return N;
+}
+
+template <typename T, std::size_t N, typename C>
+void extremum<T, N, C>::clear() noexcept
+{
+    window.clear();
+    candidates.clear();
+}
+
+template <typename T, std::size_t N, typename C>
+void extremum<T, N, C>::push(value_type input)
+{
+    if (window.full())
+    {
+        // Evict the oldest value if it is a candidate. Sequence numbers use
+        // modular arithmetic, so overflow is harmless.
+        const size_type oldest = sequence - N;
+        if (candidates.front() == oldest)
+        {
+            candidates.remove_front();
+        }
+    }
+    // Remove candidates that can never become the extremum because the new
+    // value is both newer and not ordered before them.
+    while (!candidates.empty() && !compare(input, at(candidates.back())))
+    {
+        candidates.remove_back();
+    }
+    window.push_back(std::move(input));
+    candidates.push_back(sequence);
+    ++sequence;
+}
+
+template <typename T, std::size_t N, typename C>
+auto extremum<T, N, C>::value() const noexcept -> const_reference
+{
+    assert(!empty());
+
+    return at(candidates.front());
+}
+
+template <typename T, std::size_t N, typename C>
+auto extremum<T, N, C>::begin() const noexcept -> const_iterator
+{
+    return window.begin();
+}
+
+template <typename T, std::size_t N, typename C>
+auto extremum<T, N, C>::end() const noexcept -> const_iterator
+{
+    return window.end();
+}
+
+template <typename T, std::size_t N, typename C>
+auto extremum<T, N, C>::at(size_type position) const noexcept -> const_reference
+{
+    // The front of the window has sequence number sequence - size()
+    return window[position - (sequence - window.size())];
+}
+
+} // namespace circular
+} // namespace trial
@@ -0,0 +1,232 @@
+#ifndef TRIAL_CIRCULAR_DETAIL_FFT_HPP
+#define TRIAL_CIRCULAR_DETAIL_FFT_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace trial
+{
+namespace circular
+{
+namespace detail
+{
+
+constexpr std::size_t ceil_power_of_two(std::size_t value, std::size_t result = 1)
+{
+    return (result >= value) ? result : ceil_power_of_two(value, 2 * result);
+}
+
+// Complex multiplication without the checks for infinity and NaN that some
+// compilers insert for std::complex.
+
+template <typename T>
+std::complex<T> multiply(const std::complex<T>& lhs, const std::complex<T>& rhs) noexcept
+{
+    return { lhs.real() * rhs.real() - lhs.imag() * rhs.imag(),
+             lhs.real() * rhs.imag() + lhs.imag() * rhs.real() };
+}
+
+// Iterative radix-2 fast Fourier transform of a fixed power-of-two size.
+//
+// The inverse transform is unscaled.
+
+template <typename T>
+class fft
+{
+public:
+    using complex_type = std::complex<T>;
+
+    explicit fft(std::size_t size)
+        : size(size),
+          twiddles(size / 2)
+    {
+        assert(size > 0 && (size & (size - 1)) == 0);
+
+        const T pi = std::acos(T(-1));
+        for (std::size_t k = 0; k < twiddles.size(); ++k)
+        {
+            const T angle = -2 * pi * T(k) / T(size);
+            twiddles[k] = complex_type(std::cos(angle), std::sin(angle));
+        }
+    }
+
+    void forward(complex_type *data) const noexcept
+    {
+        transform(data, false);
+    }
+
+    void inverse(complex_type *data) const noexcept
+    {
+        transform(data, true);
+    }
+
+private:
+    void transform(complex_type *data, bool invert) const noexcept
+    {
+        // Bit-reversal permutation
+        for (std::size_t i = 1, j = 0; i < size; ++i)
+        {
+            std::size_t bit = size >> 1;
+            for (; j & bit; bit >>= 1)
+            {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j)
+                std::swap(data[i], data[j]);
+        }
+        // Butterflies
+        for (std::size_t length = 2; length <= size; length <<= 1)
+        {
+            const std::size_t half = length / 2;
+            const std::size_t step = size / length;
+            for (std::size_t i = 0; i < size; i += length)
+            {
+                for (std::size_t k = 0; k < half; ++k)
+                {
+                    const complex_type& twiddle = twiddles[k * step];
+                    const complex_type factor = invert ? std::conj(twiddle) : twiddle;
+                    const complex_type even = data[i + k];
+                    const complex_type odd = multiply(data[i + k + half], factor);
+                    data[i + k] = even + odd;
+                    data[i + k + half] = even - odd;
+                }
+            }
+        }
+    }
+
+private:
+    std::size_t size;
+    std::vector<complex_type> twiddles;
+};
+
+// Overlap-save convolution with N coefficients.
+//
+// Each block of the transform size contains the N - 1 most recent samples
+// followed by block_size new samples. The first N - 1 results of the circular
+// convolution are discarded and the rest are the linear convolution.
+//
+// Only enabled for floating-point types with many coefficients, where the
+// transform is faster than the direct form.
+
+template <typename T, std::size_t N, bool = std::is_floating_point<T>::value && (N >= 128)>
+class overlap_save
+{
+public:
+    static constexpr bool enabled = false;
+    static constexpr std::size_t block_size = 0;
+
+    template <typename Iterator>
+    void reset(Iterator) noexcept
+    {
+    }
+};
+
+template <typename T, std::size_t N, bool B>
+constexpr bool overlap_save<T, N, B>::enabled;
+
+template <typename T, std::size_t N, bool B>
+constexpr std::size_t overlap_save<T, N, B>::block_size;
+
+template <typename T, std::size_t N>
+class overlap_save<T, N, true>
+{
+    using complex_type = std::complex<T>;
+
+public:
+    static constexpr bool enabled = true;
+    // A transform of four times the number of coefficients balances the cost
+    // of the transforms against the number of new samples per block.
+    static constexpr std::size_t transform_size = ceil_power_of_two(4 * N);
+    static constexpr std::size_t block_size = transform_size - N + 1;
+
+    overlap_save()
+        : transform(transform_size),
+          spectrum(transform_size),
+          buffer(transform_size)
+    {
+    }
+
+    // Calculates the spectrum of the coefficients, where the first
+    // coefficient applies to the newest sample.
+
+    template <typename Iterator>
+    void reset(Iterator coefficients)
+    {
+        for (std::size_t k = 0; k < transform_size; ++k)
+        {
+            spectrum[k] = (k < N) ? complex_type(coefficients[k]) : complex_type();
+        }
+        transform.forward(spectrum.data());
+        // Fold the scaling of the inverse transform into the spectrum
+        for (auto& value : spectrum)
+        {
+            value /= T(transform_size);
+        }
+    }
+
+    // Loads the N - 1 most recent samples and block_size new samples.
+
+    void load(const T *history, const T *input) noexcept
+    {
+        for (std::size_t k = 0; k < N - 1; ++k)
+        {
+            buffer[k] = complex_type(history[k]);
+        }
+        for (std::size_t k = 0; k < block_size; ++k)
+        {
+            buffer[N - 1 + k] = complex_type(input[k]);
+        }
+    }
+
+    // Convolves the loaded samples and stores block_size results.
+
+    void store(T *output) noexcept
+    {
+        transform.forward(buffer.data());
+        for (std::size_t k = 0; k < transform_size; ++k)
+        {
+            buffer[k] = multiply(buffer[k], spectrum[k]);
+        }
+        transform.inverse(buffer.data());
+        for (std::size_t k = 0; k < block_size; ++k)
+        {
+            output[k] = buffer[N - 1 + k].real();
+        }
+    }
+
+private:
+    fft<T> transform;
+    std::vector<complex_type> spectrum;
+    std::vector<complex_type> buffer;
+};
+
+template <typename T, std::size_t N>
+constexpr bool overlap_save<T, N, true>::enabled;
+
+template <typename T, std::size_t N>
+constexpr std::size_t overlap_save<T, N, true>::transform_size;
+
+template <typename T, std::size_t N>
+constexpr std::size_t overlap_save<T, N, true>::block_size;
+
+} // namespace detail
+} // namespace circular
+} // namespace trial
+
+#endif // TRIAL_CIRCULAR_DETAIL_FFT_HPP
@@ -0,0 +1,193 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <numeric>
+
+namespace trial
+{
+namespace circular
+{
+
+template <typename T, std::size_t N>
+fir<T, N>::fir(std::initializer_list<value_type> input)
+    : fir(input.begin(), input.end())
+{
+}
+
+template <typename T, std::size_t N>
+template <typename InputIterator>
+fir<T, N>::fir(InputIterator first, InputIterator last)
+{
+    std::array<value_type, N> input{};
+    size_type size = 0;
+    for (; first != last; ++first)
+    {
+        assert(size < N);
+        input[size] = *first;
+        ++size;
+    }
+    std::reverse_copy(input.begin(), input.end(), coefficients.begin());
+    overlap.reset(input.data());
+    clear();
+}
+
+template <typename T, std::size_t N>
+constexpr auto fir<T, N>::size() const noexcept -> size_type
+{
+    return N;
+}
+
+template <typename T, std::size_t N>
+void fir<T, N>::clear() noexcept
+{
+    history.fill(value_type{});
+    next = 0;
+}
+
+template <typename T, std::size_t N>
+void fir<T, N>::push(value_type input) noexcept
+{
+    // Overwrite the oldest sample and its mirror
+    history[next] = input;
+    history[next + N] = input;
+    next = (next + 1 == N) ? 0 : next + 1;
+}
+
+template <typename T, std::size_t N>
+auto fir<T, N>::value() const noexcept -> value_type
+{
+    // The N most recent samples are contiguous from the oldest sample
+    return std::inner_product(coefficients.begin(),
+                              coefficients.end(),
+                              history.begin() + next,
+                              value_type{});
+}
+
+template <typename T, std::size_t N>
+void fir<T, N>::process(const value_type *input,
+                        value_type *output,
+                        size_type count)
+{
+    process(input, output, count, std::integral_constant<bool, overlap_type::enabled>{});
+
+    // The remaining samples are processed in chunks that do not wrap around
+    // the history, so the windows of all outputs in a chunk are contiguous.
+    while (count > 0)
+    {
+        const size_type chunk = std::min(count, N - next);
+        process_direct(input, output, chunk);
+        input += chunk;
+        output += chunk;
+        count -= chunk;
+    }
+}
+
+template <typename T, std::size_t N>
+void fir<T, N>::process(const value_type *&input,
+                        value_type *&output,
+                        size_type& count,
+                        std::true_type)
+{
+    constexpr size_type block_size = overlap_type::block_size;
+    static_assert(block_size >= N, "Block must cover all coefficients");
+
+    while (count >= block_size)
+    {
+        // The N - 1 most recent samples follow the oldest sample
+        overlap.load(history.data() + next + 1, input);
+        // The input is loaded so the history can be replaced before output
+        // is written, as input and output may be the same.
+        assign(input + block_size - N);
+        overlap.store(output);
+        input += block_size;
+        output += block_size;
+        count -= block_size;
+    }
+}
+
+template <typename T, std::size_t N>
+void fir<T, N>::process(const value_type *&,
+                        value_type *&,
+                        size_type&,
+                        std::false_type) noexcept
+{
+}
+
+template <typename T, std::size_t N>
+void fir<T, N>::process_direct(const value_type *input,
+                               value_type *output,
+                               size_type count) noexcept
+{
+    assert(next + count <= N);
+
+    // The window of output k starts after the sample written at first + k,
+    // so it still needs the oldest samples at first + k + 1 onwards. Only the
+    // mirrors are written until all outputs have been calculated.
+    const size_type first = next;
+    std::copy(input, input + count, history.begin() + first + N);
+
+    // Each coefficient is applied to a tile of outputs before the next
+    // coefficient, so the innermost loop has no dependencies between
+    // iterations. The tile is a local array with a fixed size, so it cannot
+    // alias the history and the compiler vectorizes the loop.
+    constexpr size_type tile_size = (N < 32) ? N : 32;
+    const value_type *window = history.data() + first + 1;
+    size_type done = 0;
+    for (; done + tile_size <= count; done += tile_size)
+    {
+        value_type tile[tile_size] = {};
+        for (size_type j = 0; j < N; ++j)
+        {
+            const value_type coefficient = coefficients[j];
+            const value_type *samples = window + done + j;
+            for (size_type k = 0; k < tile_size; ++k)
+            {
+                tile[k] += coefficient * samples[k];
+            }
+        }
+        std::copy(tile, tile + tile_size, output + done);
+    }
+    if (done < count)
+    {
+        const size_type remaining = count - done;
+        value_type tile[tile_size] = {};
+        for (size_type j = 0; j < N; ++j)
+        {
+            const value_type coefficient = coefficients[j];
+            const value_type *samples = window + done + j;
+            for (size_type k = 0; k < remaining; ++k)
+            {
+                tile[k] += coefficient * samples[k];
+            }
+        }
+        std::copy(tile, tile + remaining, output + done);
+    }
+
+    // Input may have been overwritten by output, so copy from the mirrors
+    std::copy(history.begin() + first + N,
+              history.begin() + first + N + count,
+              history.begin() + first);
+    next = (first + count == N) ? 0 : first + count;
+}
+
+template <typename T, std::size_t N>
+void fir<T, N>::assign(const value_type *input) noexcept
+{
+    // Replaces the history with N samples ordered from oldest to newest
+    std::copy(input, input + N, history.begin());
+    std::copy(input, input + N, history.begin() + N);
+    next = 0;
+}
+
+} // namespace circular
+} // namespace trial
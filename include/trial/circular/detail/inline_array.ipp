@@ -0,0 +1,392 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace trial
+{
+namespace circular
+{
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+inline_array<T, N, S>::inline_array(std::initializer_list<value_type> input) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+{
+    assign(input.begin(), input.end());
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_copy_assignable<value_type>::value) -> inline_array&
+{
+    assign(input.begin(), input.end());
+    return *this;
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+bool inline_array<T, N, S>::empty() const noexcept
+{
+    return member.size == 0;
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+bool inline_array<T, N, S>::full() const noexcept
+{
+    return member.size == N;
+}
+
+template <typename T, std::size_t N, typename S>
+constexpr auto inline_array<T, N, S>::capacity() const noexcept -> size_type
+{
+    return N;
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::size() const noexcept -> size_type
+{
+    return member.size;
+}
+
+template <typename T, std::size_t N, typename S>
+constexpr auto inline_array<T, N, S>::max_size() const noexcept -> size_type
+{
+    return N;
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+void inline_array<T, N, S>::clear() noexcept
+{
+    member.first = 0;
+    member.size = 0;
+}
+
+template <typename T, std::size_t N, typename S>
+template <typename InputIterator>
+TRIAL_CXX14_CONSTEXPR
+void inline_array<T, N, S>::assign(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+{
+    auto span = view();
+    span.assign(first, last);
+    update(span);
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+void inline_array<T, N, S>::push_front(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+{
+    auto span = view();
+    span.push_front(std::move(input));
+    update(span);
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+void inline_array<T, N, S>::push_back(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+{
+    auto span = view();
+    span.push_back(std::move(input));
+    update(span);
+}
+
+template <typename T, std::size_t N, typename S>
+template <typename InputIterator>
+TRIAL_CXX14_CONSTEXPR
+void inline_array<T, N, S>::push_back(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+{
+    auto span = view();
+    span.push_back(first, last);
+    update(span);
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::pop_front() noexcept(std::is_nothrow_move_constructible<value_type>::value) -> value_type
+{
+    auto span = view();
+    auto result = span.pop_front();
+    update(span);
+    return result;
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::pop_back() noexcept(std::is_nothrow_move_constructible<value_type>::value) -> value_type
+{
+    auto span = view();
+    auto result = span.pop_back();
+    update(span);
+    return result;
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::expand_front(size_type count) noexcept -> size_type
+{
+    auto span = view();
+    const auto result = span.expand_front(count);
+    update(span);
+    return result;
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::expand_back(size_type count) noexcept -> size_type
+{
+    auto span = view();
+    const auto result = span.expand_back(count);
+    update(span);
+    return result;
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+void inline_array<T, N, S>::remove_front(size_type count) noexcept
+{
+    auto span = view();
+    span.remove_front(count);
+    update(span);
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+void inline_array<T, N, S>::remove_back(size_type count) noexcept
+{
+    auto span = view();
+    span.remove_back(count);
+    update(span);
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::front() noexcept -> reference
+{
+    return view().front();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::front() const noexcept -> const_reference
+{
+    return view().front();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::back() noexcept -> reference
+{
+    return view().back();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::back() const noexcept -> const_reference
+{
+    return view().back();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::operator[](size_type position) noexcept -> reference
+{
+    return view()[position];
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::operator[](size_type position) const noexcept -> const_reference
+{
+    return view()[position];
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::begin() noexcept -> iterator
+{
+    return view().begin();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::begin() const noexcept -> const_iterator
+{
+    return view().begin();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::cbegin() const noexcept -> const_iterator
+{
+    return view().cbegin();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::end() noexcept -> iterator
+{
+    return view().end();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::end() const noexcept -> const_iterator
+{
+    return view().end();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::cend() const noexcept -> const_iterator
+{
+    return view().cend();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::rbegin() noexcept -> reverse_iterator
+{
+    return view().rbegin();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::rbegin() const noexcept -> const_reverse_iterator
+{
+    return view().rbegin();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::crbegin() const noexcept -> const_reverse_iterator
+{
+    return view().crbegin();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::rend() noexcept -> reverse_iterator
+{
+    return view().rend();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::rend() const noexcept -> const_reverse_iterator
+{
+    return view().rend();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::crend() const noexcept -> const_reverse_iterator
+{
+    return view().crend();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::first_segment() noexcept -> segment
+{
+    return view().first_segment();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::first_segment() const noexcept -> const_segment
+{
+    return view().first_segment();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::last_segment() noexcept -> segment
+{
+    return view().last_segment();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::last_segment() const noexcept -> const_segment
+{
+    return view().last_segment();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::first_unused_segment() noexcept -> segment
+{
+    return view().first_unused_segment();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::first_unused_segment() const noexcept -> const_segment
+{
+    return view().first_unused_segment();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::last_unused_segment() noexcept -> segment
+{
+    return view().last_unused_segment();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::last_unused_segment() const noexcept -> const_segment
+{
+    return view().last_unused_segment();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::segments() noexcept -> segment_range
+{
+    return view().segments();
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::segments() const noexcept -> const_segment_range
+{
+    return view().segments();
+}
+
+// The span is recreated from the storage of this object on every operation,
+// so no absolute address is stored.
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::view() noexcept -> span
+{
+    return span(storage, storage + N, storage + member.first, member.size);
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+auto inline_array<T, N, S>::view() const noexcept -> const span
+{
+    // Only const member functions are called on the returned span
+    auto data = const_cast<value_type*>(storage);
+    return span(data, data + N, data + member.first, member.size);
+}
+
+template <typename T, std::size_t N, typename S>
+TRIAL_CXX14_CONSTEXPR
+void inline_array<T, N, S>::update(const span& other) noexcept
+{
+    member.first = other.empty() ? 0 : size_type(&other.front() - storage);
+    member.size = other.size();
+}
+
+} // namespace circular
+} // namespace trial
@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cerrno>
+#include <type_traits>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace trial
+{
+namespace circular
+{
+namespace detail
+{
+
+template <typename Circular>
+struct is_byte_buffer
+    : std::integral_constant<bool, sizeof(typename Circular::value_type) == 1>
+{
+};
+
+template <typename Circular, typename Function>
+std::size_t read_some(Circular& buffer,
+                      std::error_code& error,
+                      Function function) noexcept
+{
+    static_assert(is_byte_buffer<Circular>::value, "Circular must be a byte buffer");
+    assert(!buffer.full());
+
+    error.clear();
+    struct iovec iov[2];
+    const auto count = circular::unused_iovec(buffer, iov);
+    for (;;)
+    {
+        const auto result = function(iov, int(count));
+        if (result >= 0)
+        {
+            circular::produce(buffer, std::size_t(result));
+            return std::size_t(result);
+        }
+        if (errno != EINTR)
+        {
+            error.assign(errno, std::system_category());
+            return 0;
+        }
+    }
+}
+
+template <typename Circular, typename Function>
+std::size_t write_all(Circular& buffer,
+                      std::error_code& error,
+                      Function function) noexcept
+{
+    static_assert(is_byte_buffer<Circular>::value, "Circular must be a byte buffer");
+
+    error.clear();
+    std::size_t total = 0;
+    while (!buffer.empty())
+    {
+        struct iovec iov[2];
+        const auto count = circular::used_iovec(buffer, iov);
+        const auto result = function(iov, int(count));
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            error.assign(errno, std::system_category());
+            break;
+        }
+        if (result == 0)
+        {
+            // No progress is possible, so report the short write as an error
+            // rather than retrying forever.
+            error = std::make_error_code(std::errc::io_error);
+            break;
+        }
+        circular::consume(buffer, std::size_t(result));
+        total += std::size_t(result);
+    }
+    return total;
+}
+
+} // namespace detail
+
+template <typename Circular>
+std::size_t read_from(int fd,
+                      Circular& buffer,
+                      std::error_code& error) noexcept
+{
+    return detail::read_some(buffer,
+                             error,
+                             [fd] (struct iovec *iov, int count)
+                             {
+                                 return ::readv(fd, iov, count);
+                             });
+}
+
+template <typename Circular>
+std::size_t read_from(int socket,
+                      Circular& buffer,
+                      int flags,
+                      std::error_code& error) noexcept
+{
+    return detail::read_some(buffer,
+                             error,
+                             [socket, flags] (struct iovec *iov, int count)
+                             {
+                                 struct msghdr message = {};
+                                 message.msg_iov = iov;
+                                 message.msg_iovlen = count;
+                                 return ::recvmsg(socket, &message, flags);
+                             });
+}
+
+template <typename Circular>
+std::size_t write_to(int fd,
+                     Circular& buffer,
+                     std::error_code& error) noexcept
+{
+    return detail::write_all(buffer,
+                             error,
+                             [fd] (struct iovec *iov, int count)
+                             {
+                                 return ::writev(fd, iov, count);
+                             });
+}
+
+template <typename Circular>
+std::size_t write_to(int socket,
+                     Circular& buffer,
+                     int flags,
+                     std::error_code& error) noexcept
+{
+    return detail::write_all(buffer,
+                             error,
+                             [socket, flags] (struct iovec *iov, int count)
+                             {
+                                 struct msghdr message = {};
+                                 message.msg_iov = iov;
+                                 message.msg_iovlen = count;
+                                 return ::sendmsg(socket, &message, flags);
+                             });
+}
+
+} // namespace circular
+} // namespace trial
@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <type_traits>
+
+namespace trial
+{
+namespace circular
+{
+namespace detail
+{
+
+template <typename Segment>
+std::size_t fill_iovec(Segment first,
+                       Segment last,
+                       struct iovec (&output)[2]) noexcept
+{
+    using value_type = typename std::remove_cv<typename Segment::value_type>::type;
+    static_assert(std::is_trivially_copyable<value_type>::value, "T must be TriviallyCopyable");
+
+    output[0].iov_base = const_cast<value_type *>(first.data());
+    output[0].iov_len = first.size() * sizeof(value_type);
+    output[1].iov_base = const_cast<value_type *>(last.data());
+    output[1].iov_len = last.size() * sizeof(value_type);
+
+    return (last.size() > 0) ? 2 : ((first.size() > 0) ? 1 : 0);
+}
+
+} // namespace detail
+
+template <typename Circular>
+std::size_t used_iovec(Circular& buffer,
+                       struct iovec (&output)[2]) noexcept
+{
+    return detail::fill_iovec(buffer.first_segment(),
+                              buffer.last_segment(),
+                              output);
+}
+
+template <typename Circular>
+std::size_t unused_iovec(Circular& buffer,
+                         struct iovec (&output)[2]) noexcept
+{
+    return detail::fill_iovec(buffer.first_unused_segment(),
+                              buffer.last_unused_segment(),
+                              output);
+}
+
+template <typename Circular>
+TRIAL_CXX14_CONSTEXPR
+void consume(Circular& buffer,
+             typename Circular::size_type count) noexcept
+{
+    assert(count <= buffer.size());
+
+    if (count > 0)
+    {
+        buffer.remove_front(count);
+    }
+}
+
+template <typename Circular>
+TRIAL_CXX14_CONSTEXPR
+void produce(Circular& buffer,
+             typename Circular::size_type count) noexcept
+{
+    assert(count <= buffer.capacity() - buffer.size());
+
+    if (count > 0)
+    {
+        buffer.expand_back(count);
+    }
+}
+
+} // namespace circular
+} // namespace trial
@@ -0,0 +1,296 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <exception>
+#include <numeric>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace trial
+{
+namespace circular
+{
+namespace detail
+{
+
+struct plus
+{
+    template <typename T, typename U>
+    constexpr auto operator()(T&& lhs, U&& rhs) const -> decltype(std::forward<T>(lhs) + std::forward<U>(rhs))
+    {
+        return std::forward<T>(lhs) + std::forward<U>(rhs);
+    }
+};
+
+struct identity
+{
+    template <typename T>
+    constexpr T&& operator()(T&& value) const noexcept
+    {
+        return std::forward<T>(value);
+    }
+};
+
+// Returns the part of segment within [lower, upper)
+
+template <typename Segment>
+Segment subsegment(Segment segment, std::size_t lower, std::size_t upper) noexcept
+{
+    lower = std::min(lower, segment.size());
+    upper = std::min(upper, segment.size());
+    return (lower < upper)
+        ? Segment(segment.data() + lower, upper - lower)
+        : Segment();
+}
+
+// Calls function(chunk, offset, lower, upper) for each chunk, where offset is
+// the position of the first element of the chunk, and lower and upper are the
+// parts of the first and last segments covered by the chunk.
+//
+// The chunks are divided into balanced runs of consecutive chunks, one run
+// per thread. The calling thread processes the first run. If a thread cannot
+// be created then its run is processed by the calling thread instead.
+
+template <typename Circular, typename Function>
+void for_each_chunk(const chunked_policy& policy,
+                    Circular& buffer,
+                    Function& function)
+{
+    const auto first = buffer.first_segment();
+    const auto last = buffer.last_segment();
+    const std::size_t size = first.size() + last.size();
+    const std::size_t chunks = policy.chunks(size);
+    if (chunks == 0)
+        return;
+    const std::size_t runs = std::min(policy.threads(), chunks);
+
+    std::vector<std::exception_ptr> errors(chunks);
+    auto task = [&](std::size_t chunk)
+    {
+        // Balanced chunks whose sizes differ by at most one
+        const std::size_t lower = chunk * (size / chunks) + std::min(chunk, size % chunks);
+        const std::size_t upper = lower + size / chunks + ((chunk < size % chunks) ? 1 : 0);
+        try
+        {
+            function(chunk,
+                     lower,
+                     subsegment(first, lower, upper),
+                     subsegment(last,
+                                (lower > first.size()) ? lower - first.size() : 0,
+                                (upper > first.size()) ? upper - first.size() : 0));
+        }
+        catch (...)
+        {
+            errors[chunk] = std::current_exception();
+        }
+    };
+    auto run = [&](std::size_t index)
+    {
+        const std::size_t lower = index * (chunks / runs) + std::min(index, chunks % runs);
+        const std::size_t upper = lower + chunks / runs + ((index < chunks % runs) ? 1 : 0);
+        for (std::size_t chunk = lower; chunk < upper; ++chunk)
+        {
+            task(chunk);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(runs - 1);
+    for (std::size_t index = 1; index < runs; ++index)
+    {
+        try
+        {
+            threads.emplace_back(run, index);
+        }
+        catch (const std::system_error&)
+        {
+            run(index);
+        }
+    }
+    run(0);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (auto& error : errors)
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+// chunked_policy
+//-----------------------------------------------------------------------------
+
+inline chunked_policy::chunked_policy(std::size_t threads,
+                                      std::size_t grain) noexcept
+    : member{ (threads > 0) ? threads : std::max<std::size_t>(1, std::thread::hardware_concurrency()),
+              std::max<std::size_t>(1, grain) }
+{
+}
+
+inline std::size_t chunked_policy::threads() const noexcept
+{
+    return member.threads;
+}
+
+inline std::size_t chunked_policy::grain() const noexcept
+{
+    return member.grain;
+}
+
+inline std::size_t chunked_policy::chunks(std::size_t size) const noexcept
+{
+    if (size == 0)
+        return 0;
+    return std::max<std::size_t>(1, size / member.grain);
+}
+
+//-----------------------------------------------------------------------------
+// Chunked algorithms
+//-----------------------------------------------------------------------------
+
+template <typename Circular, typename T, typename BinaryOperation, typename UnaryOperation>
+T transform_reduce(const chunked_policy& policy,
+                   Circular& buffer,
+                   T init,
+                   BinaryOperation reduce,
+                   UnaryOperation transform)
+{
+    const std::size_t chunks = policy.chunks(buffer.size());
+    if (chunks == 0)
+        return init;
+
+    // Placeholders that are overwritten by the chunks
+    std::vector<T> partial(chunks, init);
+    auto function = [&](std::size_t chunk, std::size_t, decltype(buffer.first_segment()) lower, decltype(buffer.first_segment()) upper)
+    {
+        auto step = [&reduce, &transform](T accumulator, decltype(*lower.begin()) value)
+        {
+            return reduce(std::move(accumulator), transform(value));
+        };
+        // Chunks are never empty, so the fold starts with the first element
+        if (lower.size() > 0)
+        {
+            T result = std::accumulate(lower.begin() + 1, lower.end(), T(transform(*lower.begin())), step);
+            partial[chunk] = std::accumulate(upper.begin(), upper.end(), std::move(result), step);
+        }
+        else
+        {
+            partial[chunk] = std::accumulate(upper.begin() + 1, upper.end(), T(transform(*upper.begin())), step);
+        }
+    };
+    detail::for_each_chunk(policy, buffer, function);
+
+    for (auto& value : partial)
+    {
+        init = reduce(std::move(init), std::move(value));
+    }
+    return init;
+}
+
+template <typename Circular, typename T, typename BinaryOperation>
+T reduce(const chunked_policy& policy,
+         Circular& buffer,
+         T init,
+         BinaryOperation reduce)
+{
+    return circular::transform_reduce(policy, buffer, std::move(init), std::move(reduce), detail::identity{});
+}
+
+template <typename Circular, typename T>
+T reduce(const chunked_policy& policy,
+         Circular& buffer,
+         T init)
+{
+    return circular::reduce(policy, buffer, std::move(init), detail::plus{});
+}
+
+template <typename Circular, typename RandomAccessIterator>
+RandomAccessIterator copy(const chunked_policy& policy,
+                          Circular& buffer,
+                          RandomAccessIterator output)
+{
+    auto function = [output](std::size_t, std::size_t offset, decltype(buffer.first_segment()) lower, decltype(buffer.first_segment()) upper)
+    {
+        std::copy(upper.begin(),
+                  upper.end(),
+                  std::copy(lower.begin(), lower.end(), output + offset));
+    };
+    detail::for_each_chunk(policy, buffer, function);
+    return output + buffer.size();
+}
+
+//-----------------------------------------------------------------------------
+// Standard execution policies
+//-----------------------------------------------------------------------------
+
+#if TRIAL_CIRCULAR_EXECUTION
+
+template <typename ExecutionPolicy, typename Circular, typename T, typename BinaryOperation, typename UnaryOperation,
+          detail::enable_if_execution_policy<ExecutionPolicy>>
+T transform_reduce(ExecutionPolicy&& policy,
+                   Circular& buffer,
+                   T init,
+                   BinaryOperation reduce,
+                   UnaryOperation transform)
+{
+    auto first = buffer.first_segment();
+    auto last = buffer.last_segment();
+    T result = std::transform_reduce(policy, first.begin(), first.end(), std::move(init), reduce, transform);
+    return std::transform_reduce(policy, last.begin(), last.end(), std::move(result), reduce, transform);
+}
+
+template <typename ExecutionPolicy, typename Circular, typename T, typename BinaryOperation,
+          detail::enable_if_execution_policy<ExecutionPolicy>>
+T reduce(ExecutionPolicy&& policy,
+         Circular& buffer,
+         T init,
+         BinaryOperation reduce)
+{
+    auto first = buffer.first_segment();
+    auto last = buffer.last_segment();
+    T result = std::reduce(policy, first.begin(), first.end(), std::move(init), reduce);
+    return std::reduce(policy, last.begin(), last.end(), std::move(result), reduce);
+}
+
+template <typename ExecutionPolicy, typename Circular, typename T,
+          detail::enable_if_execution_policy<ExecutionPolicy>>
+T reduce(ExecutionPolicy&& policy,
+         Circular& buffer,
+         T init)
+{
+    return circular::reduce(std::forward<ExecutionPolicy>(policy), buffer, std::move(init), detail::plus{});
+}
+
+template <typename ExecutionPolicy, typename Circular, typename RandomAccessIterator,
+          detail::enable_if_execution_policy<ExecutionPolicy>>
+RandomAccessIterator copy(ExecutionPolicy&& policy,
+                          Circular& buffer,
+                          RandomAccessIterator output)
+{
+    auto first = buffer.first_segment();
+    auto last = buffer.last_segment();
+    return std::copy(policy,
+                     last.begin(),
+                     last.end(),
+                     std::copy(policy, first.begin(), first.end(), output));
+}
+
+#endif
+
+} // namespace circular
+} // namespace trial
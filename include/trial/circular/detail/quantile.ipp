@@ -0,0 +1,425 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+
+namespace trial
+{
+namespace circular
+{
+namespace detail
+{
+
+// Nearest-rank method with zero-based result
+
+template <typename SizeType>
+SizeType nearest_rank(double probability, SizeType size) noexcept
+{
+    assert(probability >= 0.0);
+    assert(probability <= 1.0);
+
+    const auto rank = SizeType(std::ceil(probability * size));
+    return (rank == 0) ? 0 : std::min(rank, size) - 1;
+}
+
+// Pseudo-random treap priority derived from a counter (splitmix64)
+
+inline std::uint32_t treap_priority(std::uint64_t value) noexcept
+{
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return std::uint32_t((value ^ (value >> 31)) >> 32);
+}
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+// quantile
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N, typename C>
+template <std::size_t M,
+          typename std::enable_if<M != dynamic_extent, int>::type>
+quantile<T, N, C>::quantile(const value_compare& compare)
+    : nodes(),
+      compare(compare)
+{
+}
+
+template <typename T, std::size_t N, typename C>
+template <std::size_t M,
+          typename std::enable_if<M == dynamic_extent, int>::type>
+quantile<T, N, C>::quantile(size_type capacity,
+                            const value_compare& compare)
+    : window(capacity),
+      nodes(capacity + 1),
+      compare(compare)
+{
+    assert(capacity > 0);
+}
+
+template <typename T, std::size_t N, typename C>
+bool quantile<T, N, C>::empty() const noexcept
+{
+    return window.empty();
+}
+
+template <typename T, std::size_t N, typename C>
+bool quantile<T, N, C>::full() const noexcept
+{
+    return window.size() == window.capacity();
+}
+
+template <typename T, std::size_t N, typename C>
+auto quantile<T, N, C>::size() const noexcept -> size_type
+{
+    return window.size();
+}
+
+template <typename T, std::size_t N, typename C>
+auto quantile<T, N, C>::capacity() const noexcept -> size_type
+{
+    return window.capacity();
+}
+
+template <typename T, std::size_t N, typename C>
+void quantile<T, N, C>::clear() noexcept
+{
+    window.clear();
+    root = 0;
+    sequence = 0;
+}
+
+template <typename T, std::size_t N, typename C>
+void quantile<T, N, C>::push(value_type input)
+{
+    assert(capacity() > 0);
+
+    // The node of a window position is reused when its value is evicted
+    const size_type node = 1 + sequence % capacity();
+    if (full())
+    {
+        root = erase(root, node);
+    }
+    auto& entry = nodes[node];
+    entry.value = input;
+    entry.left = 0;
+    entry.right = 0;
+    entry.count = 1;
+    entry.priority = detail::treap_priority(sequence);
+    root = insert(root, node);
+    ++sequence;
+    window.push_back(std::move(input));
+}
+
+template <typename T, std::size_t N, typename C>
+auto quantile<T, N, C>::value(double probability) const noexcept -> const_reference
+{
+    assert(!empty());
+
+    return order(detail::nearest_rank(probability, size()));
+}
+
+template <typename T, std::size_t N, typename C>
+auto quantile<T, N, C>::order(size_type position) const noexcept -> const_reference
+{
+    assert(position < size());
+
+    size_type tree = root;
+    for (;;)
+    {
+        const auto& entry = nodes[tree];
+        const size_type lower = nodes[entry.left].count;
+        if (position < lower)
+        {
+            tree = entry.left;
+        }
+        else if (position == lower)
+        {
+            return entry.value;
+        }
+        else
+        {
+            position -= lower + 1;
+            tree = entry.right;
+        }
+    }
+}
+
+template <typename T, std::size_t N, typename C>
+auto quantile<T, N, C>::begin() const noexcept -> const_iterator
+{
+    return window.begin();
+}
+
+template <typename T, std::size_t N, typename C>
+auto quantile<T, N, C>::end() const noexcept -> const_iterator
+{
+    return window.end();
+}
+
+// Nodes are ordered by value, and equal values by node number, so all keys
+// in the tree are distinct.
+
+template <typename T, std::size_t N, typename C>
+bool quantile<T, N, C>::before(size_type lhs, size_type rhs) const
+{
+    const auto& first = nodes[lhs].value;
+    const auto& second = nodes[rhs].value;
+    return compare(first, second) || (!compare(second, first) && lhs < rhs);
+}
+
+template <typename T, std::size_t N, typename C>
+void quantile<T, N, C>::recount(size_type node) noexcept
+{
+    auto& entry = nodes[node];
+    entry.count = 1 + nodes[entry.left].count + nodes[entry.right].count;
+}
+
+// Splits tree into the nodes ordered before key and the remaining nodes
+
+template <typename T, std::size_t N, typename C>
+void quantile<T, N, C>::split(size_type tree,
+                              size_type key,
+                              size_type& lower,
+                              size_type& upper)
+{
+    if (tree == 0)
+    {
+        lower = 0;
+        upper = 0;
+        return;
+    }
+    if (before(tree, key))
+    {
+        split(nodes[tree].right, key, nodes[tree].right, upper);
+        lower = tree;
+    }
+    else
+    {
+        split(nodes[tree].left, key, lower, nodes[tree].left);
+        upper = tree;
+    }
+    recount(tree);
+}
+
+template <typename T, std::size_t N, typename C>
+auto quantile<T, N, C>::insert(size_type tree, size_type node) -> size_type
+{
+    if (tree == 0)
+        return node;
+
+    if (nodes[node].priority > nodes[tree].priority)
+    {
+        split(tree, node, nodes[node].left, nodes[node].right);
+        recount(node);
+        return node;
+    }
+    if (before(node, tree))
+    {
+        nodes[tree].left = insert(nodes[tree].left, node);
+    }
+    else
+    {
+        nodes[tree].right = insert(nodes[tree].right, node);
+    }
+    recount(tree);
+    return tree;
+}
+
+template <typename T, std::size_t N, typename C>
+auto quantile<T, N, C>::erase(size_type tree, size_type node) -> size_type
+{
+    assert(tree != 0);
+
+    if (tree == node)
+        return merge(nodes[tree].left, nodes[tree].right);
+
+    if (before(node, tree))
+    {
+        nodes[tree].left = erase(nodes[tree].left, node);
+    }
+    else
+    {
+        nodes[tree].right = erase(nodes[tree].right, node);
+    }
+    recount(tree);
+    return tree;
+}
+
+// Merges two trees where all nodes in lower are ordered before upper
+
+template <typename T, std::size_t N, typename C>
+auto quantile<T, N, C>::merge(size_type lower, size_type upper) noexcept -> size_type
+{
+    if (lower == 0)
+        return upper;
+    if (upper == 0)
+        return lower;
+
+    if (nodes[lower].priority > nodes[upper].priority)
+    {
+        nodes[lower].right = merge(nodes[lower].right, upper);
+        recount(lower);
+        return lower;
+    }
+    nodes[upper].left = merge(lower, nodes[upper].left);
+    recount(upper);
+    return upper;
+}
+
+//-----------------------------------------------------------------------------
+// histogram_quantile
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+template <std::size_t M,
+          typename std::enable_if<M != dynamic_extent, int>::type>
+histogram_quantile<T, N>::histogram_quantile(value_type limit)
+    : tree(size_type(limit) + 1),
+      upper(limit)
+{
+    assert(limit > 0);
+}
+
+template <typename T, std::size_t N>
+template <std::size_t M,
+          typename std::enable_if<M == dynamic_extent, int>::type>
+histogram_quantile<T, N>::histogram_quantile(size_type capacity,
+                                             value_type limit)
+    : window(capacity),
+      tree(size_type(limit) + 1),
+      upper(limit)
+{
+    assert(capacity > 0);
+    assert(limit > 0);
+}
+
+template <typename T, std::size_t N>
+bool histogram_quantile<T, N>::empty() const noexcept
+{
+    return window.empty();
+}
+
+template <typename T, std::size_t N>
+bool histogram_quantile<T, N>::full() const noexcept
+{
+    return window.size() == window.capacity();
+}
+
+template <typename T, std::size_t N>
+auto histogram_quantile<T, N>::size() const noexcept -> size_type
+{
+    return window.size();
+}
+
+template <typename T, std::size_t N>
+auto histogram_quantile<T, N>::capacity() const noexcept -> size_type
+{
+    return window.capacity();
+}
+
+template <typename T, std::size_t N>
+auto histogram_quantile<T, N>::limit() const noexcept -> value_type
+{
+    return upper;
+}
+
+template <typename T, std::size_t N>
+void histogram_quantile<T, N>::clear() noexcept
+{
+    window.clear();
+    std::fill(tree.begin(), tree.end(), size_type(0));
+}
+
+template <typename T, std::size_t N>
+void histogram_quantile<T, N>::push(value_type input)
+{
+    assert(capacity() > 0);
+
+    if (input < value_type(0))
+    {
+        input = value_type(0);
+    }
+    else if (input >= upper)
+    {
+        input = upper - 1;
+    }
+    if (full())
+    {
+        // Modular arithmetic turns the addition into a subtraction
+        update(size_type(window.front()), size_type(-1));
+    }
+    update(size_type(input), 1);
+    window.push_back(input);
+}
+
+template <typename T, std::size_t N>
+auto histogram_quantile<T, N>::value(double probability) const noexcept -> value_type
+{
+    assert(!empty());
+
+    return order(detail::nearest_rank(probability, size()));
+}
+
+template <typename T, std::size_t N>
+auto histogram_quantile<T, N>::order(size_type position) const noexcept -> value_type
+{
+    assert(position < size());
+
+    // Binary lifting to find the smallest bucket whose prefix count exceeds
+    // the position.
+    size_type remaining = position + 1;
+    size_type bucket = 0;
+    size_type step = 1;
+    while (step * 2 < tree.size())
+    {
+        step *= 2;
+    }
+    for (; step > 0; step /= 2)
+    {
+        const auto next = bucket + step;
+        if (next < tree.size() && tree[next] < remaining)
+        {
+            bucket = next;
+            remaining -= tree[next];
+        }
+    }
+    return value_type(bucket);
+}
+
+template <typename T, std::size_t N>
+auto histogram_quantile<T, N>::begin() const noexcept -> const_iterator
+{
+    return window.begin();
+}
+
+template <typename T, std::size_t N>
+auto histogram_quantile<T, N>::end() const noexcept -> const_iterator
+{
+    return window.end();
+}
+
+template <typename T, std::size_t N>
+void histogram_quantile<T, N>::update(size_type bucket,
+                                      size_type delta) noexcept
+{
+    for (auto k = bucket + 1; k < tree.size(); k += k & (~k + 1))
+    {
+        tree[k] += delta;
+    }
+}
+
+} // namespace circular
+} // namespace trial
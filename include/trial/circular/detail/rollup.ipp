@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cassert>
+
+namespace trial
+{
+namespace circular
+{
+
+template <typename T, typename A, std::size_t... Ns>
+bool rollup<T, A, Ns...>::empty() const noexcept
+{
+    return std::get<0>(levels).empty();
+}
+
+template <typename T, typename A, std::size_t... Ns>
+void rollup<T, A, Ns...>::clear() noexcept
+{
+    clear_level<0>(is_last<0>{});
+    pending_count.fill(0);
+}
+
+template <typename T, typename A, std::size_t... Ns>
+void rollup<T, A, Ns...>::push(value_type input)
+{
+    push_level<0>(aggregator_type::lift(input), is_last<0>{});
+}
+
+template <typename T, typename A, std::size_t... Ns>
+auto rollup<T, A, Ns...>::query(size_type samples) const -> value_type
+{
+    assert(!empty());
+    assert(samples > 0);
+
+    return query_level<0>(samples, is_last<0>{});
+}
+
+template <typename T, typename A, std::size_t... Ns>
+template <std::size_t I>
+auto rollup<T, A, Ns...>::level() const noexcept -> const level_type<I>&
+{
+    return std::get<I>(levels);
+}
+
+template <typename T, typename A, std::size_t... Ns>
+template <std::size_t I>
+void rollup<T, A, Ns...>::push_level(value_type input, std::false_type)
+{
+    auto& ring = std::get<I>(levels);
+    pending[I] = (pending_count[I] == 0)
+        ? input
+        : aggregator_type::merge(pending[I], input);
+    ring.push_back(std::move(input));
+    if (++pending_count[I] == ring.capacity())
+    {
+        // Bucket is completed
+        pending_count[I] = 0;
+        push_level<I + 1>(pending[I], is_last<I + 1>{});
+    }
+}
+
+template <typename T, typename A, std::size_t... Ns>
+template <std::size_t I>
+void rollup<T, A, Ns...>::push_level(value_type input, std::true_type)
+{
+    std::get<I>(levels).push_back(std::move(input));
+}
+
+template <typename T, typename A, std::size_t... Ns>
+template <std::size_t I>
+void rollup<T, A, Ns...>::clear_level(std::false_type) noexcept
+{
+    std::get<I>(levels).clear();
+    clear_level<I + 1>(is_last<I + 1>{});
+}
+
+template <typename T, typename A, std::size_t... Ns>
+template <std::size_t I>
+void rollup<T, A, Ns...>::clear_level(std::true_type) noexcept
+{
+    std::get<I>(levels).clear();
+}
+
+template <typename T, typename A, std::size_t... Ns>
+template <std::size_t I>
+auto rollup<T, A, Ns...>::query_level(size_type entries, std::false_type) const -> value_type
+{
+    const auto& ring = std::get<I>(levels);
+    const auto& coarser = std::get<I + 1>(levels);
+    if ((entries <= ring.size()) || coarser.empty())
+        return merge_back<I>(entries);
+
+    // The incomplete bucket of this level is combined with completed buckets
+    // from the coarser level.
+    const auto remaining = entries - pending_count[I];
+    const auto buckets = (remaining + ring.capacity() - 1) / ring.capacity();
+    const auto older = query_level<I + 1>(buckets, is_last<I + 1>{});
+    return (pending_count[I] == 0)
+        ? older
+        : aggregator_type::merge(older, pending[I]);
+}
+
+template <typename T, typename A, std::size_t... Ns>
+template <std::size_t I>
+auto rollup<T, A, Ns...>::query_level(size_type entries, std::true_type) const -> value_type
+{
+    return merge_back<I>(entries);
+}
+
+template <typename T, typename A, std::size_t... Ns>
+template <std::size_t I>
+auto rollup<T, A, Ns...>::merge_back(size_type entries) const -> value_type
+{
+    const auto& ring = std::get<I>(levels);
+    assert(!ring.empty());
+
+    entries = std::min(entries, ring.size());
+    auto it = ring.end() - typename level_type<I>::iterator::difference_type(entries);
+    value_type result = *it;
+    for (++it; it != ring.end(); ++it)
+    {
+        result = aggregator_type::merge(result, *it);
+    }
+    return result;
+}
+
+} // namespace circular
+} // namespace trial
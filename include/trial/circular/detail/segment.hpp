@@ -11,6 +11,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cstddef>
 #include <trial/circular/detail/config.hpp>
 
 namespace trial
@@ -102,8 +103,106 @@ private:
     } member;
 };
 
+// Range of at most two contiguous segments
+
+template <typename Segment>
+class segment_range
+{
+public:
+    using value_type = Segment;
+    using size_type = std::size_t;
+    using pointer = Segment*;
+    using const_pointer = const Segment*;
+    using iterator = pointer;
+    using const_iterator = const_pointer;
+
+    constexpr segment_range()
+        : member{ { Segment(), Segment() }, size_type(0) }
+    {
+    }
+
+    constexpr segment_range(Segment first, Segment last)
+        : member{ { first, last },
+                  size_type(last.size() > 0 ? 2 : (first.size() > 0 ? 1 : 0)) }
+    {
+    }
+
+    constexpr bool empty() const noexcept
+    {
+        return member.size == 0;
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return member.size;
+    }
+
+    TRIAL_CXX14_CONSTEXPR
+    iterator begin() noexcept
+    {
+        return member.data;
+    }
+
+    constexpr const_iterator begin() const noexcept
+    {
+        return member.data;
+    }
+
+    constexpr const_iterator cbegin() const noexcept
+    {
+        return member.data;
+    }
+
+    TRIAL_CXX14_CONSTEXPR
+    iterator end() noexcept
+    {
+        return member.data + member.size;
+    }
+
+    constexpr const_iterator end() const noexcept
+    {
+        return member.data + member.size;
+    }
+
+    constexpr const_iterator cend() const noexcept
+    {
+        return member.data + member.size;
+    }
+
+private:
+    struct
+    {
+        Segment data[2];
+        size_type size;
+    } member;
+};
+
 } // namespace detail
 } // namespace circular
 } // namespace trial
 
+#if TRIAL_CIRCULAR_RANGES
+
+namespace std
+{
+namespace ranges
+{
+
+// Segments refer directly to the underlying storage, so they are cheap to copy
+// and their iterators outlive the segment.
+
+template <typename T>
+inline constexpr bool enable_borrowed_range<trial::circular::detail::segment<T>> = true;
+
+template <typename T>
+inline constexpr bool enable_view<trial::circular::detail::segment<T>> = true;
+
+template <typename Segment>
+inline constexpr bool enable_view<trial::circular::detail::segment_range<Segment>> = true;
+
+} // namespace ranges
+} // namespace std
+
+#endif
+
 #endif // TRIAL_CIRCULAR_DETAIL_SEGMENT_HPP
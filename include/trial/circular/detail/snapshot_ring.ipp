@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <thread>
+
+namespace trial
+{
+namespace circular
+{
+
+template <typename T, std::size_t N>
+snapshot_ring<T, N>::snapshot_ring() noexcept
+    : member{ {0}, {} }
+{
+}
+
+template <typename T, std::size_t N>
+auto snapshot_ring<T, N>::count() const noexcept -> sequence_type
+{
+    return member.sequence.load(std::memory_order_acquire) / 2;
+}
+
+template <typename T, std::size_t N>
+void snapshot_ring<T, N>::push(value_type input) noexcept
+{
+    const auto sequence = member.sequence.load(std::memory_order_relaxed);
+    member.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    member.storage[(sequence / 2) % N] = input;
+
+    member.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+template <typename T, std::size_t N>
+bool snapshot_ring<T, N>::try_snapshot(value_type *output, size_type& size) const noexcept
+{
+    const auto before = member.sequence.load(std::memory_order_acquire);
+    if (before % 2 != 0)
+        return false;
+
+    const auto ring = view(before / 2);
+    const auto first = ring.first_segment();
+    const auto last = ring.last_segment();
+    output = std::copy(first.begin(), first.end(), output);
+    std::copy(last.begin(), last.end(), output);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (member.sequence.load(std::memory_order_relaxed) != before)
+        return false;
+    size = ring.size();
+    return true;
+}
+
+template <typename T, std::size_t N>
+auto snapshot_ring<T, N>::snapshot(value_type *output) const noexcept -> size_type
+{
+    size_type size = 0;
+    while (!try_snapshot(output, size))
+    {
+        std::this_thread::yield();
+    }
+    return size;
+}
+
+template <typename T, std::size_t N>
+auto snapshot_ring<T, N>::snapshot() const noexcept -> snapshot_type
+{
+    value_type buffer[N];
+    const auto size = snapshot(buffer);
+    snapshot_type result;
+    result.assign(buffer, buffer + size);
+    return result;
+}
+
+template <typename T, std::size_t N>
+auto snapshot_ring<T, N>::view(sequence_type count) const noexcept -> view_type
+{
+    const auto size = size_type(std::min<sequence_type>(count, N));
+    const auto front = size_type((count - size) % N);
+    return view_type(member.storage,
+                     member.storage + N,
+                     member.storage + front,
+                     size);
+}
+
+} // namespace circular
+} // namespace trial
@@ -0,0 +1,233 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+namespace trial
+{
+namespace circular
+{
+
+template <std::size_t N, typename... Ts>
+template <std::size_t M,
+          typename std::enable_if<M != dynamic_extent, int>::type>
+soa<N, Ts...>::soa()
+    : columns(),
+      state(std::get<0>(columns).begin(), std::get<0>(columns).end())
+{
+}
+
+template <std::size_t N, typename... Ts>
+template <std::size_t M,
+          typename std::enable_if<M == dynamic_extent, int>::type>
+soa<N, Ts...>::soa(size_type capacity)
+    : columns(storage_type<Ts>(capacity)...),
+      state(std::get<0>(columns).begin(), std::get<0>(columns).end())
+{
+}
+
+template <std::size_t N, typename... Ts>
+soa<N, Ts...>::soa(const soa& other)
+    : columns(other.columns),
+      state(make_state(other.front_offset(), other.size()))
+{
+}
+
+template <std::size_t N, typename... Ts>
+soa<N, Ts...>::soa(soa&& other)
+    : soa(std::move(other.columns), other.front_offset(), other.size())
+{
+    // The state of other still refers to the storage that has been moved
+    other.state = other.make_state(0, 0);
+}
+
+template <std::size_t N, typename... Ts>
+soa<N, Ts...>::soa(columns_type&& input,
+                   size_type offset,
+                   size_type length)
+    : columns(std::move(input)),
+      state(make_state(offset, length))
+{
+}
+
+template <std::size_t N, typename... Ts>
+auto soa<N, Ts...>::operator=(const soa& other) -> soa&
+{
+    columns = other.columns;
+    state = make_state(other.front_offset(), other.size());
+    return *this;
+}
+
+template <std::size_t N, typename... Ts>
+auto soa<N, Ts...>::operator=(soa&& other) -> soa&
+{
+    const auto offset = other.front_offset();
+    const auto length = other.size();
+    columns = std::move(other.columns);
+    state = make_state(offset, length);
+    other.state = other.make_state(0, 0);
+    return *this;
+}
+
+template <std::size_t N, typename... Ts>
+bool soa<N, Ts...>::empty() const noexcept
+{
+    return state.empty();
+}
+
+template <std::size_t N, typename... Ts>
+bool soa<N, Ts...>::full() const noexcept
+{
+    return state.full();
+}
+
+template <std::size_t N, typename... Ts>
+auto soa<N, Ts...>::size() const noexcept -> size_type
+{
+    return state.size();
+}
+
+template <std::size_t N, typename... Ts>
+auto soa<N, Ts...>::capacity() const noexcept -> size_type
+{
+    return state.capacity();
+}
+
+template <std::size_t N, typename... Ts>
+void soa<N, Ts...>::clear() noexcept
+{
+    state.clear();
+}
+
+template <std::size_t N, typename... Ts>
+void soa<N, Ts...>::push_front(Ts... inputs)
+{
+    static_assert(detail::all_of<std::is_nothrow_move_assignable<Ts>::value...>::value, "Ts must be nothrow MoveAssignable");
+    assert(capacity() > 0);
+
+    state.expand_front();
+    assign(offset(state.front()),
+           detail::make_index_sequence<sizeof...(Ts)>{},
+           std::move(inputs)...);
+}
+
+template <std::size_t N, typename... Ts>
+void soa<N, Ts...>::push_back(Ts... inputs)
+{
+    static_assert(detail::all_of<std::is_nothrow_move_assignable<Ts>::value...>::value, "Ts must be nothrow MoveAssignable");
+    assert(capacity() > 0);
+
+    state.expand_back();
+    assign(offset(state.back()),
+           detail::make_index_sequence<sizeof...(Ts)>{},
+           std::move(inputs)...);
+}
+
+template <std::size_t N, typename... Ts>
+void soa<N, Ts...>::remove_front(size_type count) noexcept
+{
+    state.remove_front(count);
+}
+
+template <std::size_t N, typename... Ts>
+void soa<N, Ts...>::remove_back(size_type count) noexcept
+{
+    state.remove_back(count);
+}
+
+template <std::size_t N, typename... Ts>
+auto soa<N, Ts...>::operator[](size_type position) const -> value_type
+{
+    assert(position < size());
+
+    return at(offset(state[position]),
+              detail::make_index_sequence<sizeof...(Ts)>{});
+}
+
+template <std::size_t N, typename... Ts>
+template <std::size_t I>
+auto soa<N, Ts...>::column() noexcept -> column_span<I>
+{
+    auto& storage = std::get<I>(columns);
+    return column_span<I>(storage.begin(),
+                          storage.end(),
+                          storage.begin() + front_offset(),
+                          size());
+}
+
+template <std::size_t N, typename... Ts>
+template <std::size_t I>
+auto soa<N, Ts...>::column() const noexcept -> const_column_span<I>
+{
+    const auto& storage = std::get<I>(columns);
+    return const_column_span<I>(storage.begin(),
+                                storage.end(),
+                                storage.begin() + front_offset(),
+                                size());
+}
+
+template <std::size_t N, typename... Ts>
+template <std::size_t I>
+auto soa<N, Ts...>::segments() noexcept -> typename column_span<I>::segment_range
+{
+    return column<I>().segments();
+}
+
+template <std::size_t N, typename... Ts>
+template <std::size_t I>
+auto soa<N, Ts...>::segments() const noexcept -> typename const_column_span<I>::segment_range
+{
+    return column<I>().segments();
+}
+
+template <std::size_t N, typename... Ts>
+auto soa<N, Ts...>::front_offset() const noexcept -> size_type
+{
+    return state.empty() ? 0 : offset(state.front());
+}
+
+// Physical position of element in the first column applies to all columns.
+
+template <std::size_t N, typename... Ts>
+auto soa<N, Ts...>::offset(const typename state_type::value_type& element) const noexcept -> size_type
+{
+    return size_type(&element - &*std::get<0>(columns).begin());
+}
+
+template <std::size_t N, typename... Ts>
+auto soa<N, Ts...>::make_state(size_type offset, size_type length) noexcept -> state_type
+{
+    // The span constructor normalizes the next position for any offset
+    auto& storage = std::get<0>(columns);
+    return state_type(storage.begin(),
+                      storage.end(),
+                      storage.begin() + offset,
+                      length);
+}
+
+template <std::size_t N, typename... Ts>
+template <std::size_t... Is, typename... Args>
+void soa<N, Ts...>::assign(size_type offset, detail::index_sequence<Is...>, Args&&... args)
+{
+    using expand = int[];
+    (void)expand{ (std::get<Is>(columns)[offset] = std::forward<Args>(args), 0)... };
+}
+
+template <std::size_t N, typename... Ts>
+template <std::size_t... Is>
+auto soa<N, Ts...>::at(size_type offset, detail::index_sequence<Is...>) const -> value_type
+{
+    return value_type(std::get<Is>(columns)[offset]...);
+}
+
+} // namespace circular
+} // namespace trial
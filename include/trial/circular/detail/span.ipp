@@ -8,6 +8,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm> // std::min
 #include <cassert>
 
 namespace trial
@@ -19,62 +20,76 @@ namespace circular
 // span<T>
 //-----------------------------------------------------------------------------
 
-template <typename T, std::size_t E>
-constexpr span<T, E>::span() noexcept
+template <typename T, std::size_t E, typename S, typename P>
+constexpr span<T, E, S, P>::span() noexcept
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename OtherT,
           std::size_t OtherExtent,
+          typename OtherPolicy,
           typename std::enable_if<(E == OtherExtent || E == dynamic_extent) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type>
-constexpr span<T, E>::span(const span<OtherT, OtherExtent>& other) noexcept
+constexpr span<T, E, S, P>::span(const span<OtherT, OtherExtent, S, OtherPolicy>& other) noexcept
     : member(other)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename ContiguousIterator>
-constexpr span<T, E>::span(ContiguousIterator begin,
-                           ContiguousIterator end) noexcept
+constexpr span<T, E, S, P>::span(ContiguousIterator begin,
+                                 ContiguousIterator end) noexcept
     : member(std::move(begin), std::move(end))
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename ContiguousIterator>
-constexpr span<T, E>::span(ContiguousIterator begin,
-                           ContiguousIterator end,
-                           ContiguousIterator first,
-                           size_type length) noexcept
+constexpr span<T, E, S, P>::span(ContiguousIterator begin,
+                                 ContiguousIterator end,
+                                 ContiguousIterator first,
+                                 size_type length) noexcept
     : member(std::move(begin), std::move(end), std::move(first), length)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <std::size_t N,
           typename std::enable_if<(E == N || E == dynamic_extent), int>::type>
-constexpr span<T, E>::span(value_type (&array)[N]) noexcept
+constexpr span<T, E, S, P>::span(value_type (&array)[N]) noexcept
     : member(array)
 {
 }
 
-template <typename T, std::size_t E>
-constexpr span<T, E>::span(const span& other, pointer data) noexcept
-    : member(other.member, data)
+template <typename T, std::size_t E, typename S, typename P>
+constexpr span<T, E, S, P>::span(const span& other, pointer data) noexcept
+    : P(other),
+      member(other.member, data)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::assign(const span& other, pointer data) noexcept
+void span<T, E, S, P>::assign(const span& other, pointer data) noexcept
 {
+    P::operator=(other);
     member.assign(other.member, data);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
+template <typename ContiguousIterator>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> span&
+void span<T, E, S, P>::rebind(ContiguousIterator begin,
+                              ContiguousIterator end,
+                              ContiguousIterator first,
+                              size_type length) noexcept
+{
+    member = member_storage<T, E>(std::move(begin), std::move(end), std::move(first), length);
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+TRIAL_CXX14_CONSTEXPR
+auto span<T, E, S, P>::operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> span&
 {
     static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
 
@@ -82,97 +97,98 @@ auto span<T, E>::operator=(std::initializer_list<value_type> input) noexcept(std
     return *this;
 }
 
-template <typename T, std::size_t E>
-constexpr bool span<T, E>::empty() const noexcept
+template <typename T, std::size_t E, typename S, typename P>
+constexpr bool span<T, E, S, P>::empty() const noexcept
 {
     return size() == 0;
 }
 
-template <typename T, std::size_t E>
-constexpr bool span<T, E>::full() const noexcept
+template <typename T, std::size_t E, typename S, typename P>
+constexpr bool span<T, E, S, P>::full() const noexcept
 {
     return size() == capacity();
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::capacity() const noexcept -> size_type
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::capacity() const noexcept -> size_type
 {
     return member.capacity();
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::size() const noexcept -> size_type
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::size() const noexcept -> size_type
 {
     return member.size;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::front() noexcept -> reference
+auto span<T, E, S, P>::front() noexcept -> reference
 {
     assert(!empty());
 
     return at(front_index());
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::front() const noexcept -> const_reference
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::front() const noexcept -> const_reference
 {
     TRIAL_CIRCULAR_CXX14(assert(!empty()));
 
     return at(front_index());
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::back() noexcept -> reference
+auto span<T, E, S, P>::back() noexcept -> reference
 {
     assert(!empty());
 
     return at(back_index());
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::back() const noexcept -> const_reference
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::back() const noexcept -> const_reference
 {
     TRIAL_CIRCULAR_CXX14(assert(!empty()));
 
     return at(back_index());
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::operator[](size_type position) noexcept -> reference
+auto span<T, E, S, P>::operator[](size_type position) noexcept -> reference
 {
     return at(front_index() + position);
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::operator[](size_type position) const noexcept -> const_reference
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::operator[](size_type position) const noexcept -> const_reference
 {
     return at(front_index() + position);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::clear() noexcept
+void span<T, E, S, P>::clear() noexcept
 {
+    P::on_pop(member.size);
     member.size = 0;
     member.next = member.capacity();
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename InputIterator>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::assign(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+void span<T, E, S, P>::assign(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
 {
     clear();
     push_back(std::move(first), std::move(last));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::assign(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+void span<T, E, S, P>::assign(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
 {
     static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
 
@@ -183,24 +199,46 @@ void span<T, E>::assign(std::initializer_list<value_type> input) noexcept(std::i
     }
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::push_front(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+void span<T, E, S, P>::push_front(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
 {
     static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
 
+    if (P::overflow == overflow_policy::reject)
+    {
+        if (full())
+            return;
+    }
     expand_front();
     front() = std::move(input);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename InputIterator>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::push_front(InputIterator first,
-                            InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+void span<T, E, S, P>::push_front(InputIterator first,
+                                  InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
 {
     static_assert(std::is_copy_assignable<T>::value, "T must be CopyAssignable");
 
+    if (P::overflow == overflow_policy::reject)
+    {
+        try_push_front(std::move(first), std::move(last));
+        return;
+    }
+    push_front_range(std::move(first),
+                     std::move(last),
+                     typename std::iterator_traits<InputIterator>::iterator_category{});
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+template <typename InputIterator>
+TRIAL_CXX14_CONSTEXPR
+void span<T, E, S, P>::push_front_range(InputIterator first,
+                                        InputIterator last,
+                                        std::input_iterator_tag) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+{
     while (first != last)
     {
         push_front(*first);
@@ -208,24 +246,72 @@ void span<T, E>::push_front(InputIterator first,
     }
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
+template <typename ForwardIterator>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::push_back(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+void span<T, E, S, P>::push_front_range(ForwardIterator first,
+                                        ForwardIterator last,
+                                        std::forward_iterator_tag) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+{
+    // Insert in chunks of at most capacity elements, so each chunk evicts
+    // elements as whole segments.
+    auto remaining = size_type(std::distance(first, last));
+    while (remaining > 0)
+    {
+        assert(capacity() > 0);
+
+        const auto count = std::min<size_type>(remaining, capacity());
+        expand_front(count);
+        // Elements are inserted in reverse order
+        for (auto k = count; k > 0; --k)
+        {
+            operator[](k - 1) = *first;
+            ++first;
+        }
+        remaining -= count;
+    }
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+TRIAL_CXX14_CONSTEXPR
+void span<T, E, S, P>::push_back(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
 {
     static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
 
+    if (P::overflow == overflow_policy::reject)
+    {
+        if (full())
+            return;
+    }
     expand_back();
     back() = std::move(input);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename InputIterator>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::push_back(InputIterator first,
-                           InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+void span<T, E, S, P>::push_back(InputIterator first,
+                                 InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
 {
     static_assert(std::is_copy_assignable<T>::value, "T must be CopyAssignable");
 
+    if (P::overflow == overflow_policy::reject)
+    {
+        try_push_back(std::move(first), std::move(last));
+        return;
+    }
+    push_back_range(std::move(first),
+                    std::move(last),
+                    typename std::iterator_traits<InputIterator>::iterator_category{});
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+template <typename InputIterator>
+TRIAL_CXX14_CONSTEXPR
+void span<T, E, S, P>::push_back_range(InputIterator first,
+                                       InputIterator last,
+                                       std::input_iterator_tag) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+{
     while (first != last)
     {
         push_back(*first);
@@ -233,9 +319,159 @@ void span<T, E>::push_back(InputIterator first,
     }
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
+template <typename ForwardIterator>
+TRIAL_CXX14_CONSTEXPR
+void span<T, E, S, P>::push_back_range(ForwardIterator first,
+                                       ForwardIterator last,
+                                       std::forward_iterator_tag) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+{
+    // Insert in chunks of at most capacity elements, so each chunk evicts
+    // elements as whole segments.
+    auto remaining = size_type(std::distance(first, last));
+    while (remaining > 0)
+    {
+        assert(capacity() > 0);
+
+        const auto count = std::min<size_type>(remaining, capacity());
+        expand_back(count);
+        for (auto k = size() - count; k < size(); ++k)
+        {
+            operator[](k) = *first;
+            ++first;
+        }
+        remaining -= count;
+    }
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+TRIAL_CXX14_CONSTEXPR
+bool span<T, E, S, P>::try_push_front(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+{
+    static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
+
+    if (full())
+        return false;
+    expand_front();
+    front() = std::move(input);
+    return true;
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+template <typename InputIterator>
+TRIAL_CXX14_CONSTEXPR
+auto span<T, E, S, P>::try_push_front(InputIterator first,
+                                      InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value) -> size_type
+{
+    static_assert(std::is_copy_assignable<T>::value, "T must be CopyAssignable");
+
+    size_type count = 0;
+    while ((first != last) && !full())
+    {
+        expand_front();
+        front() = *first;
+        ++first;
+        ++count;
+    }
+    return count;
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+TRIAL_CXX14_CONSTEXPR
+bool span<T, E, S, P>::try_push_back(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+{
+    static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
+
+    if (full())
+        return false;
+    expand_back();
+    back() = std::move(input);
+    return true;
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+template <typename InputIterator>
+TRIAL_CXX14_CONSTEXPR
+auto span<T, E, S, P>::try_push_back(InputIterator first,
+                                     InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value) -> size_type
+{
+    static_assert(std::is_copy_assignable<T>::value, "T must be CopyAssignable");
+
+    size_type count = 0;
+    while ((first != last) && !full())
+    {
+        expand_back();
+        back() = *first;
+        ++first;
+        ++count;
+    }
+    return count;
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+auto span<T, E, S, P>::insert(const_iterator position,
+                              value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> iterator
+{
+    static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
+    assert(!full());
+
+    const auto offset = size_type(position - cbegin());
+    if (offset < size() - offset)
+    {
+        // Move front elements one step towards the front
+        expand_front();
+        move_range(0, 1, offset);
+    }
+    else
+    {
+        // Move back elements one step towards the back
+        expand_back();
+        move_range(offset + 1, offset, size() - 1 - offset);
+    }
+    operator[](offset) = std::move(input);
+    return begin() + offset;
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+auto span<T, E, S, P>::erase(const_iterator position) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> iterator
+{
+    assert(position != cend());
+
+    return erase(position, position + 1);
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+auto span<T, E, S, P>::erase(const_iterator first,
+                             const_iterator last) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> iterator
+{
+    static_assert(std::is_move_assignable<T>::value, "T must be MoveAssignable");
+
+    const auto offset = size_type(first - cbegin());
+    const auto count = size_type(last - first);
+    assert(offset + count <= size());
+
+    if (count > 0)
+    {
+        const auto remaining = size() - offset - count;
+        if (offset < remaining)
+        {
+            // Move front elements towards the back
+            move_range(count, 0, offset);
+            remove_front(count);
+        }
+        else
+        {
+            // Move back elements towards the front
+            move_range(offset, offset + count, remaining);
+            remove_back(count);
+        }
+    }
+    return begin() + offset;
+}
+
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::pop_front() noexcept(std::is_nothrow_move_constructible<value_type>::value) -> value_type
+auto span<T, E, S, P>::pop_front() noexcept(std::is_nothrow_move_constructible<value_type>::value) -> value_type
 {
     static_assert(std::is_move_constructible<T>::value, "T must be MoveConstructible");
 
@@ -244,9 +480,9 @@ auto span<T, E>::pop_front() noexcept(std::is_nothrow_move_constructible<value_t
     return std::move(old_front);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::pop_back() noexcept(std::is_nothrow_move_constructible<value_type>::value) -> value_type
+auto span<T, E, S, P>::pop_back() noexcept(std::is_nothrow_move_constructible<value_type>::value) -> value_type
 {
     static_assert(std::is_move_constructible<T>::value, "T must be MoveConstructible");
 
@@ -255,13 +491,30 @@ auto span<T, E>::pop_back() noexcept(std::is_nothrow_move_constructible<value_ty
     return std::move(old_back);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::expand_front(size_type count) noexcept
+auto span<T, E, S, P>::expand_front(size_type count) noexcept -> size_type
 {
     assert(count <= capacity());
+    assert((P::overflow != overflow_policy::assertion) || (count <= capacity() - size()));
+
+    if (P::overflow == overflow_policy::reject)
+    {
+        // Only the unused elements can be inserted
+        count = std::min<size_type>(count, capacity() - size());
+    }
 
     const auto unused = capacity() - size();
+    if (count > 0)
+    {
+        if (count > unused)
+        {
+            P::on_overwrite(count - unused);
+            evict(member.next - (count - unused), count - unused);
+        }
+        if (count > index(front_index()))
+            P::on_wraparound();
+    }
     if (count > unused)
     {
         member.next = member.capacity() + index(member.next - count + unused);
@@ -271,14 +524,33 @@ void span<T, E>::expand_front(size_type count) noexcept
     {
         member.size += count;
     }
+    P::on_push(count, size());
+    return count;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::expand_back(size_type count) noexcept
+auto span<T, E, S, P>::expand_back(size_type count) noexcept -> size_type
 {
     assert(count <= capacity());
+    assert((P::overflow != overflow_policy::assertion) || (count <= capacity() - size()));
+
+    if (P::overflow == overflow_policy::reject)
+    {
+        // Only the unused elements can be inserted
+        count = std::min<size_type>(count, capacity() - size());
+    }
 
+    if (count > 0)
+    {
+        if (count > capacity() - size())
+        {
+            P::on_overwrite(count - (capacity() - size()));
+            evict(front_index(), count - (capacity() - size()));
+        }
+        if (index(member.next) + count >= capacity())
+            P::on_wraparound();
+    }
     if (count > capacity() - size())
     {
         member.next = member.capacity() + index(member.next + count);
@@ -289,32 +561,85 @@ void span<T, E>::expand_back(size_type count) noexcept
         member.next = member.capacity() + index(member.next + count);
         member.size += count;
     }
+    P::on_push(count, size());
+    return count;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::remove_front(size_type count) noexcept
+void span<T, E, S, P>::evict(size_type position, size_type count) noexcept
+{
+    // Evicted elements are passed as at most two contiguous segments
+    const auto first = index(position);
+    const auto length = std::min<size_type>(count, capacity() - first);
+    P::on_evict(segment(member.data + first, length));
+    if (count > length)
+    {
+        P::on_evict(segment(member.data, count - length));
+    }
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+void span<T, E, S, P>::move_range(size_type target,
+                                  size_type source,
+                                  size_type count) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+{
+    // Positions are relative to the front. The ranges are split into runs
+    // that are contiguous in both source and target storage.
+    if (target < source)
+    {
+        // Move from the front to avoid overwriting overlapping elements
+        while (count > 0)
+        {
+            const auto from = index(front_index() + source);
+            const auto to = index(front_index() + target);
+            const auto run = std::min<size_type>(count, std::min<size_type>(capacity() - from, capacity() - to));
+            detail::move_forward(member.data + from, member.data + from + run, member.data + to);
+            source += run;
+            target += run;
+            count -= run;
+        }
+    }
+    else if (target > source)
+    {
+        // Move from the back to avoid overwriting overlapping elements
+        while (count > 0)
+        {
+            const auto from_last = index(front_index() + source + count - 1) + 1;
+            const auto to_last = index(front_index() + target + count - 1) + 1;
+            const auto run = std::min<size_type>(count, std::min<size_type>(from_last, to_last));
+            detail::move_backward(member.data + from_last - run, member.data + from_last, member.data + to_last);
+            count -= run;
+        }
+    }
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+TRIAL_CXX14_CONSTEXPR
+void span<T, E, S, P>::remove_front(size_type count) noexcept
 {
     assert(size() > 0);
     assert(count <= size());
 
     member.size -= count;
+    P::on_pop(count);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::remove_back(size_type count) noexcept
+void span<T, E, S, P>::remove_back(size_type count) noexcept
 {
     assert(size() > 0);
     assert(count <= size());
 
     member.next = member.capacity() + index(member.next - count);
     member.size -= count;
+    P::on_pop(count);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::rotate_front() noexcept(detail::is_nothrow_swappable<value_type>::value)
+void span<T, E, S, P>::rotate_front() noexcept(detail::is_nothrow_swappable<value_type>::value)
 {
     if (empty())
         return;
@@ -328,85 +653,85 @@ void span<T, E>::rotate_front() noexcept(detail::is_nothrow_swappable<value_type
     member.next = member.capacity() + size();
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::begin() noexcept -> iterator
+auto span<T, E, S, P>::begin() noexcept -> iterator
 {
-    return iterator(this, vindex(front_index()));
+    return iterator(member.data, member.capacity(), vindex(front_index()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::begin() const noexcept -> const_iterator
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::begin() const noexcept -> const_iterator
 {
-    return const_iterator(this, vindex(front_index()));
+    return const_iterator(member.data, member.capacity(), vindex(front_index()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::cbegin() const noexcept -> const_iterator
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::cbegin() const noexcept -> const_iterator
 {
-    return const_iterator(this, vindex(front_index()));
+    return const_iterator(member.data, member.capacity(), vindex(front_index()));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::end() noexcept -> iterator
+auto span<T, E, S, P>::end() noexcept -> iterator
 {
-    return iterator(this, vindex(member.next));
+    return iterator(member.data, member.capacity(), vindex(member.next));
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::end() const noexcept -> const_iterator
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::end() const noexcept -> const_iterator
 {
-    return const_iterator(this, vindex(member.next));
+    return const_iterator(member.data, member.capacity(), vindex(member.next));
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::cend() const noexcept -> const_iterator
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::cend() const noexcept -> const_iterator
 {
-    return const_iterator(this, vindex(member.next));
+    return const_iterator(member.data, member.capacity(), vindex(member.next));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::rbegin() noexcept -> reverse_iterator
+auto span<T, E, S, P>::rbegin() noexcept -> reverse_iterator
 {
     return reverse_iterator(std::move(end()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::rbegin() const noexcept -> const_reverse_iterator
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::rbegin() const noexcept -> const_reverse_iterator
 {
     return const_reverse_iterator(std::move(end()));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::rend() noexcept -> reverse_iterator
+auto span<T, E, S, P>::rend() noexcept -> reverse_iterator
 {
     return reverse_iterator(std::move(begin()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::rend() const noexcept -> const_reverse_iterator
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::rend() const noexcept -> const_reverse_iterator
 {
     return const_reverse_iterator(std::move(begin()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::crbegin() const noexcept -> const_reverse_iterator
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::crbegin() const noexcept -> const_reverse_iterator
 {
     return const_reverse_iterator(std::move(end()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::crend() const noexcept -> const_reverse_iterator
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::crend() const noexcept -> const_reverse_iterator
 {
     return const_reverse_iterator(std::move(begin()));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::first_segment() noexcept -> segment
+auto span<T, E, S, P>::first_segment() noexcept -> segment
 {
     return (empty())
         ? segment()
@@ -417,8 +742,8 @@ auto span<T, E>::first_segment() noexcept -> segment
                      member.data + index(back_index()) + 1));
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::first_segment() const noexcept -> const_segment
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::first_segment() const noexcept -> const_segment
 {
     return (empty())
         ? const_segment()
@@ -429,9 +754,9 @@ constexpr auto span<T, E>::first_segment() const noexcept -> const_segment
                            member.data + index(back_index()) + 1));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::last_segment() noexcept -> segment
+auto span<T, E, S, P>::last_segment() noexcept -> segment
 {
     return wraparound() && (index(member.next) < size())
         ? segment(member.data,
@@ -439,8 +764,8 @@ auto span<T, E>::last_segment() noexcept -> segment
         : segment();
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::last_segment() const noexcept -> const_segment
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::last_segment() const noexcept -> const_segment
 {
     return wraparound() && (index(member.next) < size())
         ? const_segment(member.data,
@@ -448,31 +773,34 @@ constexpr auto span<T, E>::last_segment() const noexcept -> const_segment
         : const_segment();
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::first_unused_segment() noexcept -> segment
+auto span<T, E, S, P>::first_unused_segment() noexcept -> segment
 {
     return (full())
         ? segment()
-        : segment(member.data + member.next - capacity(),
-                  member.data + std::min(front_index(), capacity()));
+        : (unused_wraparound() || index(front_index()) == 0
+           ? segment(member.data + index(member.next),
+                     member.data + capacity())
+           : segment(member.data + index(member.next),
+                     member.data + index(front_index())));
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::first_unused_segment() const noexcept -> const_segment
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::first_unused_segment() const noexcept -> const_segment
 {
     return (full())
         ? const_segment()
-        : (wraparound()
-           ? const_segment(member.data + back_index() + 1,
+        : (unused_wraparound() || index(front_index()) == 0
+           ? const_segment(member.data + index(member.next),
                            member.data + capacity())
-           : const_segment(member.data + back_index() + 1,
-                           member.data + capacity()));
+           : const_segment(member.data + index(member.next),
+                           member.data + index(front_index())));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::last_unused_segment() noexcept -> segment
+auto span<T, E, S, P>::last_unused_segment() noexcept -> segment
 {
     return (full() || !unused_wraparound())
         ? segment()
@@ -480,8 +808,8 @@ auto span<T, E>::last_unused_segment() noexcept -> segment
                   member.data + index(front_index()));
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::last_unused_segment() const noexcept -> const_segment
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::last_unused_segment() const noexcept -> const_segment
 {
     return (full() || !unused_wraparound())
         ? const_segment()
@@ -489,61 +817,95 @@ constexpr auto span<T, E>::last_unused_segment() const noexcept -> const_segment
                         member.data + index(front_index()));
 }
 
+template <typename T, std::size_t E, typename S, typename P>
+TRIAL_CXX14_CONSTEXPR
+auto span<T, E, S, P>::segments() noexcept -> segment_range
+{
+    return segment_range(first_segment(), last_segment());
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::segments() const noexcept -> const_segment_range
+{
+    return const_segment_range(first_segment(), last_segment());
+}
+
 //-----------------------------------------------------------------------------
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::index(size_type position) const noexcept -> size_type
+template <typename T, std::size_t E, typename S, typename P>
+template <typename U>
+constexpr auto span<T, E, S, P>::stats() const noexcept -> decltype(std::declval<const U&>().stats())
+{
+    return P::stats();
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+TRIAL_CXX14_CONSTEXPR
+auto span<T, E, S, P>::get_policy() noexcept -> P&
+{
+    return *this;
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::get_policy() const noexcept -> const P&
+{
+    return *this;
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::index(size_type position) const noexcept -> size_type
 {
     return position % member.capacity();
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::vindex(size_type position) const noexcept -> size_type
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::vindex(size_type position) const noexcept -> size_type
 {
     return position % (2 * member.capacity());
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::front_index() const noexcept -> size_type
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::front_index() const noexcept -> size_type
 {
     return member.next - member.size;
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::back_index() const noexcept -> size_type
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::back_index() const noexcept -> size_type
 {
     return member.next - 1;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::at(size_type position) noexcept -> reference
+auto span<T, E, S, P>::at(size_type position) noexcept -> reference
 {
     return member.data[index(position)];
 }
 
-template <typename T, std::size_t E>
-constexpr auto span<T, E>::at(size_type position) const noexcept -> const_reference
+template <typename T, std::size_t E, typename S, typename P>
+constexpr auto span<T, E, S, P>::at(size_type position) const noexcept -> const_reference
 {
     return member.data[index(position)];
 }
 
-template <typename T, std::size_t E>
-constexpr bool span<T, E>::wraparound() const noexcept
+template <typename T, std::size_t E, typename S, typename P>
+constexpr bool span<T, E, S, P>::wraparound() const noexcept
 {
     return index(front_index()) > index(back_index());
 }
 
-template <typename T, std::size_t E>
-constexpr bool span<T, E>::unused_wraparound() const noexcept
+// Unused elements continue from the end of storage to the beginning of storage
+template <typename T, std::size_t E, typename S, typename P>
+constexpr bool span<T, E, S, P>::unused_wraparound() const noexcept
 {
-    return front_index() > capacity();
+    return (index(front_index()) > 0) && (index(front_index()) <= index(member.next));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::rotate_range(size_type lower_length,
-                              size_type upper_length) noexcept(detail::is_nothrow_swappable<value_type>::value)
+void span<T, E, S, P>::rotate_range(size_type lower_length,
+                                    size_type upper_length) noexcept(detail::is_nothrow_swappable<value_type>::value)
 {
     // Based on Gries-Mills block swapping rotate
     if (lower_length == 0 || upper_length == 0)
@@ -565,16 +927,15 @@ void span<T, E>::rotate_range(size_type lower_length,
     swap_range(position - lower_length, position, lower_length);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::swap_range(size_type lhs,
-                            size_type rhs,
-                            size_type length) noexcept(detail::is_nothrow_swappable<value_type>::value)
+void span<T, E, S, P>::swap_range(size_type lhs,
+                                  size_type rhs,
+                                  size_type length) noexcept(detail::is_nothrow_swappable<value_type>::value)
 {
     for (size_type k = 0; k < length; ++k)
     {
-        using std::swap;
-        swap(at(lhs + k), at(rhs + k));
+        detail::constexpr_swap(at(lhs + k), at(rhs + k));
     }
  }
 
@@ -585,53 +946,55 @@ void span<T, E>::swap_range(size_type lhs,
 // std::addressof(x) and std::distance(a, b) are not constexpr before C++17, so
 // we use &x and b - a instead, which ought to work for ContiguousIterator.
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1, std::size_t E1>
-constexpr span<T, E>::member_storage<T1, E1>::member_storage() noexcept
+constexpr span<T, E, S, P>::member_storage<T1, E1>::member_storage() noexcept
     : data(nullptr),
       size(0),
       next(0)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1, std::size_t E1>
-constexpr span<T, E>::member_storage<T1, E1>::member_storage(pointer data,
-                                                             size_type size,
-                                                             size_type next) noexcept
+constexpr span<T, E, S, P>::member_storage<T1, E1>::member_storage(pointer data,
+                                                                   size_type size,
+                                                                   size_type next) noexcept
     : data(data),
       size(size),
       next(next)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1, std::size_t E1>
-constexpr span<T, E>::member_storage<T1, E1>::member_storage(const member_storage& other,
-                                                             pointer data) noexcept
+constexpr span<T, E, S, P>::member_storage<T1, E1>::member_storage(const member_storage& other,
+                                                                   pointer data) noexcept
     : data(data),
       size(other.size),
       next(other.next)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1, std::size_t E1>
-template <typename OtherT, std::size_t OtherExtent>
-constexpr span<T, E>::member_storage<T1, E1>::member_storage(const span<OtherT,
-                                                             OtherExtent>& other) noexcept
+template <typename OtherT, std::size_t OtherExtent, typename OtherPolicy>
+constexpr span<T, E, S, P>::member_storage<T1, E1>::member_storage(const span<OtherT,
+                                                                   OtherExtent,
+                                                                   S,
+                                                                   OtherPolicy>& other) noexcept
     : data(other.member.data),
       size(other.member.size),
       next(other.member.next)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1, std::size_t E1>
 template <typename ContiguousIterator>
 TRIAL_CXX14_CONSTEXPR
-span<T, E>::member_storage<T1, E1>::member_storage(ContiguousIterator begin,
-                                                   ContiguousIterator end) noexcept
+span<T, E, S, P>::member_storage<T1, E1>::member_storage(ContiguousIterator begin,
+                                                         ContiguousIterator end) noexcept
     : data(begin == end ? nullptr : &*begin),
       size(0),
       next(size_type(end - begin))
@@ -639,49 +1002,50 @@ span<T, E>::member_storage<T1, E1>::member_storage(ContiguousIterator begin,
     assert(size_type(end - begin) == capacity());
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1, std::size_t E1>
 template <typename ContiguousIterator>
 TRIAL_CXX14_CONSTEXPR
-span<T, E>::member_storage<T1, E1>::member_storage(ContiguousIterator begin,
-                                                   ContiguousIterator end,
-                                                   ContiguousIterator first,
-                                                   size_type length) noexcept
+span<T, E, S, P>::member_storage<T1, E1>::member_storage(ContiguousIterator begin,
+                                                         ContiguousIterator end,
+                                                         ContiguousIterator first,
+                                                         size_type length) noexcept
     : data(begin == end ? nullptr : &*begin),
       size(length),
-      next(size_type(first - begin) + length)
+      // The next position is kept within [capacity, 2 * capacity)
+      next(begin == end ? size_type(0) : size_type(E1 + (size_type(first - begin) + length) % E1))
 {
     assert(size_type(end - begin) == capacity());
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1, std::size_t E1>
 template <std::size_t N>
-constexpr span<T, E>::member_storage<T1, E1>::member_storage(value_type (&array)[N]) noexcept
+constexpr span<T, E, S, P>::member_storage<T1, E1>::member_storage(value_type (&array)[N]) noexcept
     : member_storage(array, array + N)
 {
     static_assert(N >= E1, "N cannot be smaller than capacity");
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1, std::size_t E1>
-constexpr auto span<T, E>::member_storage<T1, E1>::capacity() const noexcept -> size_type
+constexpr auto span<T, E, S, P>::member_storage<T1, E1>::capacity() const noexcept -> size_type
 {
     return E1;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1, std::size_t E1>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::member_storage<T1, E1>::capacity(size_type) noexcept
+void span<T, E, S, P>::member_storage<T1, E1>::capacity(size_type) noexcept
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1, std::size_t E1>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::member_storage<T1, E1>::assign(const member_storage& other,
-                                                pointer data) noexcept
+void span<T, E, S, P>::member_storage<T1, E1>::assign(const member_storage& other,
+                                                      pointer data) noexcept
 {
     this->data = data;
     this->size = other.size;
@@ -692,9 +1056,9 @@ void span<T, E>::member_storage<T1, E1>::assign(const member_storage& other,
 // span<T>::member_storage dynamic extent
 //-----------------------------------------------------------------------------
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1>
-constexpr span<T, E>::member_storage<T1, dynamic_extent>::member_storage() noexcept
+constexpr span<T, E, S, P>::member_storage<T1, dynamic_extent>::member_storage() noexcept
     : data(nullptr),
       cap(0),
       size(0),
@@ -702,12 +1066,12 @@ constexpr span<T, E>::member_storage<T1, dynamic_extent>::member_storage() noexc
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1>
-constexpr span<T, E>::member_storage<T1, dynamic_extent>::member_storage(pointer data,
-                                                                         size_type capacity,
-                                                                         size_type size,
-                                                                         size_type next) noexcept
+constexpr span<T, E, S, P>::member_storage<T1, dynamic_extent>::member_storage(pointer data,
+                                                                               size_type capacity,
+                                                                               size_type size,
+                                                                               size_type next) noexcept
     : data(data),
       cap(capacity),
       size(size),
@@ -715,10 +1079,10 @@ constexpr span<T, E>::member_storage<T1, dynamic_extent>::member_storage(pointer
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1>
-constexpr span<T, E>::member_storage<T1, dynamic_extent>::member_storage(const member_storage& other,
-                                                                         pointer data) noexcept
+constexpr span<T, E, S, P>::member_storage<T1, dynamic_extent>::member_storage(const member_storage& other,
+                                                                               pointer data) noexcept
     : data(data),
       cap(other.cap),
       size(other.size),
@@ -726,10 +1090,10 @@ constexpr span<T, E>::member_storage<T1, dynamic_extent>::member_storage(const m
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1>
-template <typename OtherT, std::size_t OtherExtent>
-constexpr span<T, E>::member_storage<T1, dynamic_extent>::member_storage(const span<OtherT, OtherExtent>& other) noexcept
+template <typename OtherT, std::size_t OtherExtent, typename OtherPolicy>
+constexpr span<T, E, S, P>::member_storage<T1, dynamic_extent>::member_storage(const span<OtherT, OtherExtent, S, OtherPolicy>& other) noexcept
     : data(other.member.data),
       cap(other.member.capacity()),
       size(other.member.size),
@@ -737,60 +1101,63 @@ constexpr span<T, E>::member_storage<T1, dynamic_extent>::member_storage(const s
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1>
 template <typename ContiguousIterator>
-constexpr span<T, E>::member_storage<T1, dynamic_extent>::member_storage(ContiguousIterator begin,
-                                                                         ContiguousIterator end) noexcept
+constexpr span<T, E, S, P>::member_storage<T1, dynamic_extent>::member_storage(ContiguousIterator begin,
+                                                                               ContiguousIterator end) noexcept
     : data(begin == end ? nullptr : &*begin),
       cap(size_type(end - begin)),
       size(0),
       next(size_type(end - begin))
 {
+    TRIAL_CIRCULAR_CXX14(assert(std::size_t(end - begin) < std::size_t(std::numeric_limits<size_type>::max()) / 2));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1>
 template <typename ContiguousIterator>
-constexpr span<T, E>::member_storage<T1, dynamic_extent>::member_storage(ContiguousIterator begin,
-                                                                         ContiguousIterator end,
-                                                                         ContiguousIterator first,
-                                                                         size_type length) noexcept
+constexpr span<T, E, S, P>::member_storage<T1, dynamic_extent>::member_storage(ContiguousIterator begin,
+                                                                               ContiguousIterator end,
+                                                                               ContiguousIterator first,
+                                                                               size_type length) noexcept
     : data(begin == end ? nullptr : &*begin),
       cap(size_type(end - begin)),
       size(length),
-      next(size_type(first - begin) + length)
+      // The next position is kept within [capacity, 2 * capacity)
+      next(begin == end ? size_type(0) : size_type((end - begin) + (size_type(first - begin) + length) % size_type(end - begin)))
 {
+    TRIAL_CIRCULAR_CXX14(assert(std::size_t(end - begin) < std::size_t(std::numeric_limits<size_type>::max()) / 2));
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1>
 template <std::size_t N>
-constexpr span<T, E>::member_storage<T1, dynamic_extent>::member_storage(value_type (&array)[N]) noexcept
+constexpr span<T, E, S, P>::member_storage<T1, dynamic_extent>::member_storage(value_type (&array)[N]) noexcept
     : member_storage(array, array + N)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1>
-constexpr auto span<T, E>::member_storage<T1, dynamic_extent>::capacity() const noexcept -> size_type
+constexpr auto span<T, E, S, P>::member_storage<T1, dynamic_extent>::capacity() const noexcept -> size_type
 {
     return cap;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::member_storage<T1, dynamic_extent>::capacity(size_type value) noexcept
+void span<T, E, S, P>::member_storage<T1, dynamic_extent>::capacity(size_type value) noexcept
 {
     cap = value;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename T1>
 TRIAL_CXX14_CONSTEXPR
-void span<T, E>::member_storage<T1, dynamic_extent>::assign(const member_storage& other,
-                                                            pointer data) noexcept
+void span<T, E, S, P>::member_storage<T1, dynamic_extent>::assign(const member_storage& other,
+                                                                  pointer data) noexcept
 {
     this->data = data;
     capacity(other.capacity());
@@ -798,208 +1165,263 @@ void span<T, E>::member_storage<T1, dynamic_extent>::assign(const member_storage
     this->next = other.next;
 }
 
+//-----------------------------------------------------------------------------
+// span<T>::iterator_storage fixed extent
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t E, typename S, typename P>
+template <typename Pointer, std::size_t E1>
+constexpr span<T, E, S, P>::iterator_storage<Pointer, E1>::iterator_storage() noexcept
+    : data(nullptr),
+      current(0)
+{
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+template <typename Pointer, std::size_t E1>
+constexpr span<T, E, S, P>::iterator_storage<Pointer, E1>::iterator_storage(Pointer data,
+                                                                            size_type,
+                                                                            size_type current) noexcept
+    : data(data),
+      current(current)
+{
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+template <typename Pointer, std::size_t E1>
+constexpr auto span<T, E, S, P>::iterator_storage<Pointer, E1>::capacity() const noexcept -> size_type
+{
+    return E1;
+}
+
+//-----------------------------------------------------------------------------
+// span<T>::iterator_storage dynamic extent
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t E, typename S, typename P>
+template <typename Pointer>
+constexpr span<T, E, S, P>::iterator_storage<Pointer, dynamic_extent>::iterator_storage() noexcept
+    : data(nullptr),
+      cap(0),
+      current(0)
+{
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+template <typename Pointer>
+constexpr span<T, E, S, P>::iterator_storage<Pointer, dynamic_extent>::iterator_storage(Pointer data,
+                                                                                        size_type capacity,
+                                                                                        size_type current) noexcept
+    : data(data),
+      cap(capacity),
+      current(current)
+{
+}
+
+template <typename T, std::size_t E, typename S, typename P>
+template <typename Pointer>
+constexpr auto span<T, E, S, P>::iterator_storage<Pointer, dynamic_extent>::capacity() const noexcept -> size_type
+{
+    return cap;
+}
+
 //-----------------------------------------------------------------------------
 // span<T>::basic_iterator
 //-----------------------------------------------------------------------------
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
-constexpr span<T, E>::basic_iterator<U>::basic_iterator(span_pointer parent,
-                                                        size_type position) noexcept
-    : parent(parent),
-      current(position)
+constexpr span<T, E, S, P>::basic_iterator<U>::basic_iterator(pointer data,
+                                                              size_type capacity,
+                                                              size_type position) noexcept
+    : member(data, capacity, position)
 {
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
+template <typename U>
+constexpr auto span<T, E, S, P>::basic_iterator<U>::vindex(size_type position) const noexcept -> size_type
+{
+    return position % (2 * member.capacity());
+}
+
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::basic_iterator<U>::operator++() noexcept -> iterator_type&
+auto span<T, E, S, P>::basic_iterator<U>::operator++() noexcept -> iterator_type&
 {
-    assert(parent);
+    assert(member.data);
 
-    current = parent->vindex(current + 1);
+    member.current = vindex(member.current + 1);
     return *this;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::basic_iterator<U>::operator++(int) noexcept -> iterator_type
+auto span<T, E, S, P>::basic_iterator<U>::operator++(int) noexcept -> iterator_type
 {
-    assert(parent);
+    assert(member.data);
 
     auto before = *this;
-    current = parent->vindex(current + 1);
+    member.current = vindex(member.current + 1);
     return before;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::basic_iterator<U>::operator--() noexcept -> iterator_type&
+auto span<T, E, S, P>::basic_iterator<U>::operator--() noexcept -> iterator_type&
 {
-    assert(parent);
+    assert(member.data);
 
-    current = parent->vindex(current - 1);
+    member.current = vindex(member.current - 1);
     return *this;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::basic_iterator<U>::operator--(int) noexcept -> iterator_type
+auto span<T, E, S, P>::basic_iterator<U>::operator--(int) noexcept -> iterator_type
 {
-    assert(parent);
+    assert(member.data);
 
     auto before = *this;
-    current = parent->vindex(current - 1);
+    member.current = vindex(member.current - 1);
     return before;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::basic_iterator<U>::operator+=(difference_type amount) noexcept -> iterator_type&
+auto span<T, E, S, P>::basic_iterator<U>::operator+=(difference_type amount) noexcept -> iterator_type&
 {
-    assert(parent);
+    assert(member.data);
 
-    current = parent->vindex(current + amount);
+    member.current = vindex(member.current + amount);
     return *this;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
-constexpr auto span<T, E>::basic_iterator<U>::operator+(difference_type amount) const noexcept -> iterator_type
+constexpr auto span<T, E, S, P>::basic_iterator<U>::operator+(difference_type amount) const noexcept -> iterator_type
 {
-    TRIAL_CIRCULAR_CXX14(assert(parent));
+    TRIAL_CIRCULAR_CXX14(assert(member.data));
 
-    return iterator_type(parent, current + amount);
+    return iterator_type(member.data, member.capacity(), member.current + amount);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
 TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::basic_iterator<U>::operator-=(difference_type amount) noexcept -> iterator_type&
+auto span<T, E, S, P>::basic_iterator<U>::operator-=(difference_type amount) noexcept -> iterator_type&
 {
-    assert(parent);
+    assert(member.data);
 
-    current = parent->vindex(current - amount);
+    member.current = vindex(member.current - amount);
     return *this;
 }
 
-template <typename T, std::size_t E>
-template <typename U>
-constexpr auto span<T, E>::basic_iterator<U>::operator-(difference_type amount) const noexcept -> iterator_type
-{
-    TRIAL_CIRCULAR_CXX14(assert(parent));
-
-    return iterator_type(parent, current - amount);
-}
-
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
-constexpr auto span<T, E>::basic_iterator<U>::operator-(const iterator_type& other) const noexcept -> difference_type
+constexpr auto span<T, E, S, P>::basic_iterator<U>::operator-(difference_type amount) const noexcept -> iterator_type
 {
-    TRIAL_CIRCULAR_CXX14(assert(parent));
+    TRIAL_CIRCULAR_CXX14(assert(member.data));
 
-    return current - other.current;
+    return iterator_type(member.data, member.capacity(), member.current - amount);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
-TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::basic_iterator<U>::operator[](difference_type amount) noexcept -> reference
+constexpr auto span<T, E, S, P>::basic_iterator<U>::operator-(const iterator_type& other) const noexcept -> difference_type
 {
-    assert(parent);
+    TRIAL_CIRCULAR_CXX14(assert(member.data));
 
-    return parent->at(current + amount);
+    return member.current - other.member.current;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
-TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::basic_iterator<U>::operator-> () noexcept -> pointer
+constexpr auto span<T, E, S, P>::basic_iterator<U>::operator[](difference_type amount) const noexcept -> reference
 {
-    assert(parent);
+    TRIAL_CIRCULAR_CXX14(assert(member.data));
 
-    return *parent->at(current);
+    return member.data[(member.current + amount) % member.capacity()];
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
-TRIAL_CXX14_CONSTEXPR
-auto span<T, E>::basic_iterator<U>::operator*() noexcept -> reference
+constexpr auto span<T, E, S, P>::basic_iterator<U>::operator-> () const noexcept -> pointer
 {
-    assert(parent);
+    TRIAL_CIRCULAR_CXX14(assert(member.data));
 
-    return parent->at(current);
+    return &member.data[member.current % member.capacity()];
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
-constexpr auto span<T, E>::basic_iterator<U>::operator*() const noexcept -> const_reference
+constexpr auto span<T, E, S, P>::basic_iterator<U>::operator*() const noexcept -> reference
 {
-    TRIAL_CIRCULAR_CXX14(assert(parent));
+    TRIAL_CIRCULAR_CXX14(assert(member.data));
 
-    return parent->at(current);
+    return member.data[member.current % member.capacity()];
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
-constexpr bool span<T, E>::basic_iterator<U>::operator==(const iterator_type& other) const noexcept
+constexpr bool span<T, E, S, P>::basic_iterator<U>::operator==(const iterator_type& other) const noexcept
 {
-    TRIAL_CIRCULAR_CXX14(assert(parent));
-    TRIAL_CIRCULAR_CXX14(assert(parent == other.parent));
+    TRIAL_CIRCULAR_CXX14(assert(member.data));
+    TRIAL_CIRCULAR_CXX14(assert(member.data == other.member.data));
 
-    return current == other.current;
+    return member.current == other.member.current;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
-constexpr bool span<T, E>::basic_iterator<U>::operator!=(const iterator_type& other) const noexcept
+constexpr bool span<T, E, S, P>::basic_iterator<U>::operator!=(const iterator_type& other) const noexcept
 {
     return !operator==(other);
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
-constexpr bool span<T, E>::basic_iterator<U>::operator<(const iterator_type& other) const noexcept
+constexpr bool span<T, E, S, P>::basic_iterator<U>::operator<(const iterator_type& other) const noexcept
 {
-    TRIAL_CIRCULAR_CXX14(assert(parent));
-    TRIAL_CIRCULAR_CXX14(assert(parent == other.parent));
+    TRIAL_CIRCULAR_CXX14(assert(member.data));
+    TRIAL_CIRCULAR_CXX14(assert(member.data == other.member.data));
 
-    return current < other.current;
+    return member.current < other.member.current;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
-constexpr bool span<T, E>::basic_iterator<U>::operator<=(const iterator_type& other) const noexcept
+constexpr bool span<T, E, S, P>::basic_iterator<U>::operator<=(const iterator_type& other) const noexcept
 {
-    TRIAL_CIRCULAR_CXX14(assert(parent));
-    TRIAL_CIRCULAR_CXX14(assert(parent == other.parent));
+    TRIAL_CIRCULAR_CXX14(assert(member.data));
+    TRIAL_CIRCULAR_CXX14(assert(member.data == other.member.data));
 
-    return current <= other.current;
+    return member.current <= other.member.current;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
-constexpr bool span<T, E>::basic_iterator<U>::operator>(const iterator_type& other) const noexcept
+constexpr bool span<T, E, S, P>::basic_iterator<U>::operator>(const iterator_type& other) const noexcept
 {
-    TRIAL_CIRCULAR_CXX14(assert(parent));
-    TRIAL_CIRCULAR_CXX14(assert(parent == other.parent));
+    TRIAL_CIRCULAR_CXX14(assert(member.data));
+    TRIAL_CIRCULAR_CXX14(assert(member.data == other.member.data));
 
-    return current > other.current;
+    return member.current > other.member.current;
 }
 
-template <typename T, std::size_t E>
+template <typename T, std::size_t E, typename S, typename P>
 template <typename U>
-constexpr bool span<T, E>::basic_iterator<U>::operator>=(const iterator_type& other) const noexcept
+constexpr bool span<T, E, S, P>::basic_iterator<U>::operator>=(const iterator_type& other) const noexcept
 {
-    TRIAL_CIRCULAR_CXX14(assert(parent));
-    TRIAL_CIRCULAR_CXX14(assert(parent == other.parent));
+    TRIAL_CIRCULAR_CXX14(assert(member.data));
+    TRIAL_CIRCULAR_CXX14(assert(member.data == other.member.data));
 
-    return current >= other.current;
+    return member.current >= other.member.current;
 }
 
 } // namespace circular
@@ -0,0 +1,254 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace trial
+{
+namespace circular
+{
+namespace detail
+{
+
+// Knuth's branch-free TwoSum: sum + error == lhs + rhs exactly
+
+template <typename T>
+void two_sum(T lhs, T rhs, T& sum, T& error) noexcept
+{
+    sum = lhs + rhs;
+    const T virtual_rhs = sum - lhs;
+    error = (lhs - (sum - virtual_rhs)) + (rhs - virtual_rhs);
+}
+
+// The reductions use independent partial results so that the compiler can
+// vectorize them without reassociating floating-point operations.
+
+template <typename T>
+void segment_sum(const T *first, const T *last, T& sum, T& compensation) noexcept
+{
+    T lane[4] = {};
+    T error[4] = {};
+    for (; last - first >= 4; first += 4)
+    {
+        for (int k = 0; k < 4; ++k)
+        {
+            T partial;
+            T residual;
+            two_sum(lane[k], first[k], partial, residual);
+            lane[k] = partial;
+            error[k] += residual;
+        }
+    }
+    for (; first != last; ++first)
+    {
+        T partial;
+        T residual;
+        two_sum(lane[0], *first, partial, residual);
+        lane[0] = partial;
+        error[0] += residual;
+    }
+    for (int k = 0; k < 4; ++k)
+    {
+        T partial;
+        T residual;
+        two_sum(sum, lane[k], partial, residual);
+        sum = partial;
+        compensation += residual + error[k];
+    }
+}
+
+template <typename T>
+T segment_squares(const T *first, const T *last, T mean) noexcept
+{
+    T lane[4] = {};
+    for (; last - first >= 4; first += 4)
+    {
+        const T d0 = first[0] - mean;
+        const T d1 = first[1] - mean;
+        const T d2 = first[2] - mean;
+        const T d3 = first[3] - mean;
+        lane[0] += d0 * d0;
+        lane[1] += d1 * d1;
+        lane[2] += d2 * d2;
+        lane[3] += d3 * d3;
+    }
+    for (; first != last; ++first)
+    {
+        const T d = *first - mean;
+        lane[0] += d * d;
+    }
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+}
+
+} // namespace detail
+
+template <typename T, std::size_t N>
+template <std::size_t M,
+          typename std::enable_if<M != dynamic_extent, int>::type>
+statistics<T, N>::statistics() noexcept
+{
+}
+
+template <typename T, std::size_t N>
+template <std::size_t M,
+          typename std::enable_if<M == dynamic_extent, int>::type>
+statistics<T, N>::statistics(size_type capacity)
+    : window(capacity)
+{
+    assert(capacity > 0);
+}
+
+template <typename T, std::size_t N>
+bool statistics<T, N>::empty() const noexcept
+{
+    return window.empty();
+}
+
+template <typename T, std::size_t N>
+bool statistics<T, N>::full() const noexcept
+{
+    return window.size() == window.capacity();
+}
+
+template <typename T, std::size_t N>
+auto statistics<T, N>::size() const noexcept -> size_type
+{
+    return window.size();
+}
+
+template <typename T, std::size_t N>
+auto statistics<T, N>::capacity() const noexcept -> size_type
+{
+    return window.capacity();
+}
+
+template <typename T, std::size_t N>
+void statistics<T, N>::clear() noexcept
+{
+    window.clear();
+    member.sum = value_type(0);
+    member.compensation = value_type(0);
+    member.squares = value_type(0);
+    member.evictions = 0;
+}
+
+template <typename T, std::size_t N>
+void statistics<T, N>::push(value_type input) noexcept
+{
+    assert(capacity() > 0);
+
+    if (full())
+    {
+        // Replace oldest value with input
+        const value_type oldest = window.front();
+        const value_type old_mean = mean();
+        add(input);
+        add(-oldest);
+        window.push_back(input);
+        const value_type new_mean = mean();
+        member.squares += (input - oldest) * ((input - new_mean) + (oldest - old_mean));
+
+        if (++member.evictions >= capacity())
+        {
+            recalculate();
+        }
+    }
+    else
+    {
+        const value_type old_mean = empty() ? input : mean();
+        add(input);
+        window.push_back(input);
+        const value_type new_mean = mean();
+        member.squares += (input - old_mean) * (input - new_mean);
+    }
+}
+
+template <typename T, std::size_t N>
+auto statistics<T, N>::sum() const noexcept -> value_type
+{
+    return member.sum + member.compensation;
+}
+
+template <typename T, std::size_t N>
+auto statistics<T, N>::mean() const noexcept -> value_type
+{
+    assert(!empty());
+
+    return sum() / size();
+}
+
+template <typename T, std::size_t N>
+auto statistics<T, N>::variance() const noexcept -> value_type
+{
+    assert(!empty());
+
+    // Rounding errors may cause slightly negative results
+    return std::max(member.squares, value_type(0)) / size();
+}
+
+template <typename T, std::size_t N>
+auto statistics<T, N>::unbiased_variance() const noexcept -> value_type
+{
+    assert(size() > 1);
+
+    return std::max(member.squares, value_type(0)) / (size() - 1);
+}
+
+template <typename T, std::size_t N>
+auto statistics<T, N>::standard_deviation() const noexcept -> value_type
+{
+    return std::sqrt(variance());
+}
+
+template <typename T, std::size_t N>
+void statistics<T, N>::recalculate() noexcept
+{
+    member.evictions = 0;
+    member.sum = value_type(0);
+    member.compensation = value_type(0);
+    member.squares = value_type(0);
+    if (empty())
+        return;
+
+    const auto first = window.first_segment();
+    const auto last = window.last_segment();
+    detail::segment_sum(first.begin(), first.end(), member.sum, member.compensation);
+    detail::segment_sum(last.begin(), last.end(), member.sum, member.compensation);
+    const value_type average = mean();
+    member.squares = detail::segment_squares(first.begin(), first.end(), average)
+        + detail::segment_squares(last.begin(), last.end(), average);
+}
+
+template <typename T, std::size_t N>
+auto statistics<T, N>::begin() const noexcept -> const_iterator
+{
+    return window.begin();
+}
+
+template <typename T, std::size_t N>
+auto statistics<T, N>::end() const noexcept -> const_iterator
+{
+    return window.end();
+}
+
+template <typename T, std::size_t N>
+void statistics<T, N>::add(value_type input) noexcept
+{
+    value_type total;
+    value_type error;
+    detail::two_sum(member.sum, input, total, error);
+    member.compensation += error;
+    member.sum = total;
+}
+
+} // namespace circular
+} // namespace trial
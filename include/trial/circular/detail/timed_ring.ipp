@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <trial/circular/algorithm.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+template <typename T, typename C>
+timed_ring<T, C>::timed_ring(size_type capacity)
+    : member{ timestamp_container(capacity), value_container(capacity) }
+{
+    assert(capacity > 0);
+}
+
+template <typename T, typename C>
+bool timed_ring<T, C>::empty() const noexcept
+{
+    return member.values.empty();
+}
+
+template <typename T, typename C>
+bool timed_ring<T, C>::full() const noexcept
+{
+    return member.values.full();
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::size() const noexcept -> size_type
+{
+    return member.values.size();
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::capacity() const noexcept -> size_type
+{
+    return member.values.capacity();
+}
+
+template <typename T, typename C>
+void timed_ring<T, C>::clear() noexcept
+{
+    member.timestamps.clear();
+    member.values.clear();
+}
+
+template <typename T, typename C>
+void timed_ring<T, C>::push(time_point when, value_type input)
+{
+    assert(empty() || !(when < member.timestamps.back()));
+
+    member.timestamps.push_back(when);
+    member.values.push_back(std::move(input));
+}
+
+template <typename T, typename C>
+void timed_ring<T, C>::push(value_type input)
+{
+    push(clock::now(), std::move(input));
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::expire(time_point cutoff) noexcept -> size_type
+{
+    const auto where = circular::lower_bound(member.timestamps, cutoff);
+    const auto count = size_type(where - member.timestamps.begin());
+    if (count > 0)
+    {
+        member.timestamps.remove_front(count);
+        member.values.remove_front(count);
+    }
+    return count;
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::front() noexcept -> reference
+{
+    return member.values.front();
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::front() const noexcept -> const_reference
+{
+    return member.values.front();
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::back() noexcept -> reference
+{
+    return member.values.back();
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::back() const noexcept -> const_reference
+{
+    return member.values.back();
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::front_time() const noexcept -> time_point
+{
+    return member.timestamps.front();
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::back_time() const noexcept -> time_point
+{
+    return member.timestamps.back();
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::values() const noexcept -> const value_container&
+{
+    return member.values;
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::timestamps() const noexcept -> const timestamp_container&
+{
+    return member.timestamps;
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::begin() noexcept -> iterator
+{
+    return member.values.begin();
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::begin() const noexcept -> const_iterator
+{
+    return member.values.begin();
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::end() noexcept -> iterator
+{
+    return member.values.end();
+}
+
+template <typename T, typename C>
+auto timed_ring<T, C>::end() const noexcept -> const_iterator
+{
+    return member.values.end();
+}
+
+} // namespace circular
+} // namespace trial
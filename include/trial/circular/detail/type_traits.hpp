@@ -11,7 +11,9 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 namespace trial
 {
@@ -48,6 +50,51 @@ struct is_nothrow_swappable
 
 #endif
 
+#if __cpp_lib_integer_sequence >= 201304L
+
+template <std::size_t... Is>
+using index_sequence = std::index_sequence<Is...>;
+
+template <std::size_t N>
+using make_index_sequence = std::make_index_sequence<N>;
+
+#else
+
+template <std::size_t... Is>
+struct index_sequence
+{
+};
+
+template <std::size_t N, std::size_t... Is>
+struct make_index_sequence_helper
+    : make_index_sequence_helper<N - 1, N - 1, Is...>
+{
+};
+
+template <std::size_t... Is>
+struct make_index_sequence_helper<0, Is...>
+{
+    using type = index_sequence<Is...>;
+};
+
+template <std::size_t N>
+using make_index_sequence = typename make_index_sequence_helper<N>::type;
+
+#endif
+
+// Checks if all conditions are true.
+
+template <bool...>
+struct bool_sequence
+{
+};
+
+template <bool... Bs>
+struct all_of
+    : std::is_same<bool_sequence<true, Bs...>, bool_sequence<Bs..., true>>
+{
+};
+
 } // namespace detail
 } // namespace circular
 } // namespace trial
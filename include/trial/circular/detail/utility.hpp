@@ -0,0 +1,85 @@
+#ifndef TRIAL_CIRCULAR_DETAIL_UTILITY_HPP
+#define TRIAL_CIRCULAR_DETAIL_UTILITY_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <trial/circular/detail/config.hpp>
+#include <trial/circular/detail/type_traits.hpp>
+
+namespace trial
+{
+namespace circular
+{
+namespace detail
+{
+
+// std::swap is not constexpr before C++20, so trivially copyable elements are
+// swapped by copying. Other elements use the swap found by ADL.
+
+template <typename T,
+          typename std::enable_if<std::is_trivially_copyable<T>::value, int>::type = 0>
+TRIAL_CXX14_CONSTEXPR
+void constexpr_swap(T& lhs, T& rhs) noexcept
+{
+    T temporary = lhs;
+    lhs = rhs;
+    rhs = temporary;
+}
+
+template <typename T,
+          typename std::enable_if<!std::is_trivially_copyable<T>::value, int>::type = 0>
+TRIAL_CXX20_CONSTEXPR
+void constexpr_swap(T& lhs, T& rhs) noexcept(detail::is_nothrow_swappable<T>::value)
+{
+    using std::swap;
+    swap(lhs, rhs);
+}
+
+// Moves elements within contiguous storage where the ranges may overlap.
+// Trivially copyable elements are moved with std::memmove.
+
+template <typename T,
+          typename std::enable_if<std::is_trivially_copyable<T>::value, int>::type = 0>
+void move_forward(T *first, T *last, T *output) noexcept
+{
+    std::memmove(output, first, std::size_t(last - first) * sizeof(T));
+}
+
+template <typename T,
+          typename std::enable_if<!std::is_trivially_copyable<T>::value, int>::type = 0>
+void move_forward(T *first, T *last, T *output) noexcept(std::is_nothrow_move_assignable<T>::value)
+{
+    std::move(first, last, output);
+}
+
+template <typename T,
+          typename std::enable_if<std::is_trivially_copyable<T>::value, int>::type = 0>
+void move_backward(T *first, T *last, T *output_last) noexcept
+{
+    std::memmove(output_last - (last - first), first, std::size_t(last - first) * sizeof(T));
+}
+
+template <typename T,
+          typename std::enable_if<!std::is_trivially_copyable<T>::value, int>::type = 0>
+void move_backward(T *first, T *last, T *output_last) noexcept(std::is_nothrow_move_assignable<T>::value)
+{
+    std::move_backward(first, last, output_last);
+}
+
+} // namespace detail
+} // namespace circular
+} // namespace trial
+
+#endif // TRIAL_CIRCULAR_DETAIL_UTILITY_HPP
@@ -8,129 +8,144 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-#include <utility> // std::swap
+#include <trial/circular/detail/utility.hpp>
 
 namespace trial
 {
 namespace circular
 {
 
-template <typename T, typename A>
-vector<T, A>::vector() noexcept(std::is_nothrow_default_constructible<storage>::value)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+vector<T, A, P>::vector() noexcept(std::is_nothrow_default_constructible<storage>::value)
     : span(storage::begin(), storage::end())
 {
 }
 
-template <typename T, typename A>
-vector<T, A>::vector(const allocator_type& allocator) noexcept(std::is_nothrow_constructible<storage, const allocator_type&>::value)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+vector<T, A, P>::vector(const allocator_type& allocator) noexcept(std::is_nothrow_constructible<storage, const allocator_type&>::value)
     : storage(allocator),
       span(storage::begin(), storage::end())
 {
 }
 
-template <typename T, typename A>
-vector<T, A>::vector(const vector& other)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+vector<T, A, P>::vector(const vector& other)
     : storage(static_cast<const storage&>(other)),
-      span(static_cast<const span&>(other), &*storage::begin())
+      span(static_cast<const span&>(other), storage::data())
 {
 }
 
-template <typename T, typename A>
-vector<T, A>::vector(const vector& other,
-                     const allocator_type& allocator)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+vector<T, A, P>::vector(const vector& other,
+                        const allocator_type& allocator)
     : storage(static_cast<const storage&>(other), allocator),
-      span(static_cast<const span&>(other), &*storage::begin())
+      span(static_cast<const span&>(other), storage::data())
 {
 }
 
-template <typename T, typename A>
-vector<T, A>::vector(vector&& other,
-                     const allocator_type& allocator) noexcept(std::is_nothrow_constructible<storage, storage&&, const allocator_type&>::value)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+vector<T, A, P>::vector(vector&& other,
+                        const allocator_type& allocator) noexcept(std::is_nothrow_constructible<storage, storage&&, const allocator_type&>::value)
     : storage(std::forward<storage>(other), allocator),
-      span(std::forward<span>(other), &*storage::begin())
+      span(std::forward<span>(other), storage::data())
 {
 }
 
-template <typename T, typename A>
-vector<T, A>::vector(size_type capacity)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+vector<T, A, P>::vector(size_type capacity)
     : storage(capacity),
       span(storage::begin(), storage::end())
 {
 }
 
-template <typename T, typename A>
-vector<T, A>::vector(size_type capacity,
-                     const allocator_type& allocator)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+vector<T, A, P>::vector(size_type capacity,
+                        const allocator_type& allocator)
     : storage(capacity, T{}, allocator),
       span(storage::begin(), storage::end())
 {
 }
 
-template <typename T, typename A>
-vector<T, A>::vector(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+vector<T, A, P>::vector(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value)
     : storage(input.size()),
       span(storage::begin(), storage::end())
 {
     span::operator=(std::move(input));
 }
 
-template <typename T, typename A>
-vector<T, A>::vector(std::initializer_list<value_type> input,
-                     const allocator_type& allocator) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+vector<T, A, P>::vector(std::initializer_list<value_type> input,
+                        const allocator_type& allocator) noexcept(std::is_nothrow_move_assignable<value_type>::value)
     : storage(input.size(), T{}, allocator),
       span(storage::begin(), storage::end())
 {
     span::operator=(std::move(input));
 }
 
-template <typename T, typename A>
-auto vector<T, A>::operator=(const vector& other) -> vector&
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+auto vector<T, A, P>::operator=(const vector& other) -> vector&
 {
     storage::operator=(static_cast<const storage&>(other));
-    span::assign(static_cast<const span&>(other), &*storage::begin());
+    span::assign(static_cast<const span&>(other), storage::data());
     return *this;
 }
 
-template <typename T, typename A>
-auto vector<T, A>::operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> vector&
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+auto vector<T, A, P>::operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value) -> vector&
 {
     span::clear();
     if (input.size() > storage::size())
     {
         storage::resize(std::min(input.size(), storage::capacity()));
     }
-    span::operator=(span(storage::begin(), storage::end(), storage::begin(), storage::size()));
+    span::rebind(storage::begin(), storage::end(), storage::begin(), storage::size());
     span::operator=(std::move(input));
     return *this;
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename P>
 template <typename InputIterator>
-vector<T, A>::vector(InputIterator first,
-                     InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+TRIAL_CXX20_CONSTEXPR
+vector<T, A, P>::vector(InputIterator first,
+                        InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
     : storage(first, last),
       span(storage::begin(), storage::end(), storage::begin(), storage::size())
 {
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename P>
 template <typename InputIterator>
-vector<T, A>::vector(InputIterator first,
-                     InputIterator last,
-                     const allocator_type& allocator) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
+TRIAL_CXX20_CONSTEXPR
+vector<T, A, P>::vector(InputIterator first,
+                        InputIterator last,
+                        const allocator_type& allocator) noexcept(std::is_nothrow_copy_assignable<value_type>::value)
     : storage(first, last, allocator),
       span(storage::begin(), storage::end(), storage::begin(), storage::size())
 {
 }
 
-template <typename T, typename A>
-auto vector<T, A>::get_allocator() const -> allocator_type
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+auto vector<T, A, P>::get_allocator() const -> allocator_type
 {
     return storage::get_allocator();
 }
 
-template <typename T, typename A>
-void vector<T, A>::reserve(size_type capacity)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+void vector<T, A, P>::reserve(size_type capacity)
 {
     if (capacity <= storage::capacity())
         return;
@@ -141,20 +156,22 @@ void vector<T, A>::reserve(size_type capacity)
         span::rotate_front();
     }
     storage::reserve(capacity);
-    span::operator=(span(storage::begin(),
-                         storage::end(),
-                         storage::begin(),
-                         span::size()));
+    span::rebind(storage::begin(),
+                 storage::end(),
+                 storage::begin(),
+                 span::size());
 }
 
-template <typename T, typename A>
-void vector<T, A>::resize(size_type count)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+void vector<T, A, P>::resize(size_type count)
 {
     resize(count, value_type{});
 }
 
-template <typename T, typename A>
-void vector<T, A>::resize(size_type count, const value_type& value)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+void vector<T, A, P>::resize(size_type count, const value_type& value)
 {
     span::rotate_front();
     storage::resize(count, value);
@@ -164,11 +181,12 @@ void vector<T, A>::resize(size_type count, const value_type& value)
     {
         storage::operator[](k) = value;
     }
-    span::operator=(span(storage::begin(), storage::end(), storage::begin(), storage::size()));
+    span::rebind(storage::begin(), storage::end(), storage::begin(), storage::size());
 }
 
-template <typename T, typename A>
-void vector<T, A>::push_front(value_type input)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+void vector<T, A, P>::push_front(value_type input)
 {
     if (span::full())
     {
@@ -197,15 +215,16 @@ void vector<T, A>::push_front(value_type input)
             //   | Z | A | B | C |   |
             //   +---+---+---+---+---+
 
+            span::rotate_front();
             storage::push_back(std::move(input));
-            span::operator=(span(storage::begin(), storage::end(), storage::begin(), storage::size()));
+            span::rebind(storage::begin(), storage::end(), storage::begin(), storage::size());
+            P::on_push(1, span::size());
 
             // Move to beginning is a linear operation.
 
             for (size_type k = size() - 1; k != 0; --k)
             {
-                using std::swap;
-                swap(span::operator[](k - 1), span::operator[](k));
+                detail::constexpr_swap(span::operator[](k - 1), span::operator[](k));
             }
             return;
         }
@@ -213,8 +232,9 @@ void vector<T, A>::push_front(value_type input)
     span::push_front(std::move(input));
 }
 
-template <typename T, typename A>
-void vector<T, A>::push_back(value_type input)
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+void vector<T, A, P>::push_back(value_type input)
 {
     if (span::full())
     {
@@ -222,13 +242,54 @@ void vector<T, A>::push_back(value_type input)
         {
             // Insert element at end where there is spare capacity.
 
+            span::rotate_front();
             storage::push_back(std::move(input));
-            span::operator=(span(storage::begin(), storage::end(), storage::begin(), storage::size()));
+            span::rebind(storage::begin(), storage::end(), storage::begin(), storage::size());
+            P::on_push(1, span::size());
             return;
         }
     }
     span::push_back(std::move(input));
 }
 
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+bool vector<T, A, P>::try_push_front(value_type input)
+{
+    if (span::full() && (span::capacity() == storage::capacity()))
+        return false;
+    push_front(std::move(input));
+    return true;
+}
+
+template <typename T, typename A, typename P>
+TRIAL_CXX20_CONSTEXPR
+bool vector<T, A, P>::try_push_back(value_type input)
+{
+    if (span::full() && (span::capacity() == storage::capacity()))
+        return false;
+    push_back(std::move(input));
+    return true;
+}
+
+template <typename T, typename A, typename P>
+auto vector<T, A, P>::insert(const_iterator position, value_type input) -> iterator
+{
+    if (span::full() && (span::capacity() < storage::capacity()))
+    {
+        // Grow the storage by one element that is left unused by the span,
+        // so the span can insert by moving the shorter side.
+        //
+        // The input is stored in the new element until it is passed to the
+        // span.
+        const auto offset = size_type(position - span::cbegin());
+        span::rotate_front();
+        storage::push_back(std::move(input));
+        span::rebind(storage::begin(), storage::end(), storage::begin(), storage::size() - 1);
+        return span::insert(span::cbegin() + offset, std::move(storage::back()));
+    }
+    return span::insert(position, std::move(input));
+}
+
 } // namespace circular
 } // namespace trial
@@ -0,0 +1,37 @@
+#ifndef TRIAL_CIRCULAR_DETAIL_WINDOW_HPP
+#define TRIAL_CIRCULAR_DETAIL_WINDOW_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <type_traits>
+#include <trial/circular/array.hpp>
+#include <trial/circular/vector.hpp>
+
+namespace trial
+{
+namespace circular
+{
+namespace detail
+{
+
+// Moving window is a circular array with fixed extent, or a circular vector
+// with dynamic extent.
+
+template <typename T, std::size_t N>
+using window = typename std::conditional<N == dynamic_extent,
+                                         circular::vector<T>,
+                                         circular::array<T, N>>::type;
+
+} // namespace detail
+} // namespace circular
+} // namespace trial
+
+#endif // TRIAL_CIRCULAR_DETAIL_WINDOW_HPP
@@ -0,0 +1,205 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <algorithm>
+
+namespace trial
+{
+namespace circular
+{
+
+//-----------------------------------------------------------------------------
+// work_stealing_deque::storage
+//-----------------------------------------------------------------------------
+
+// Circular buffer of atomic slots indexed by unbounded positions.
+
+template <typename T>
+class work_stealing_deque<T>::storage
+{
+public:
+    explicit storage(size_type capacity)
+        : mask(capacity - 1),
+          slots(new std::atomic<value_type>[capacity])
+    {
+        assert((capacity & mask) == 0);
+    }
+
+    size_type capacity() const noexcept
+    {
+        return mask + 1;
+    }
+
+    size_type index(index_type position) const noexcept
+    {
+        return size_type(position) & mask;
+    }
+
+    value_type load(index_type position) const noexcept
+    {
+        return slots[index(position)].load(std::memory_order_relaxed);
+    }
+
+    void store(index_type position, value_type input) noexcept
+    {
+        slots[index(position)].store(input, std::memory_order_relaxed);
+    }
+
+    // Copies the elements in [front, back) from other storage.
+    //
+    // The range is split into the two contiguous segments of the other
+    // storage, which are copied in order.
+
+    void assign(const storage& other, index_type front, index_type back) noexcept
+    {
+        const auto length = size_type(back - front);
+        const auto first = other.index(front);
+        const auto first_length = std::min(length, other.capacity() - first);
+
+        index_type position = front;
+        for (size_type k = first; k < first + first_length; ++k, ++position)
+        {
+            store(position, other.slots[k].load(std::memory_order_relaxed));
+        }
+        for (size_type k = 0; k < length - first_length; ++k, ++position)
+        {
+            store(position, other.slots[k].load(std::memory_order_relaxed));
+        }
+    }
+
+private:
+    const size_type mask;
+    std::unique_ptr<std::atomic<value_type>[]> slots;
+};
+
+//-----------------------------------------------------------------------------
+// work_stealing_deque
+//-----------------------------------------------------------------------------
+
+template <typename T>
+work_stealing_deque<T>::work_stealing_deque(size_type capacity)
+{
+    assert(capacity > 0);
+
+    size_type rounded = 1;
+    while (rounded < capacity)
+        rounded <<= 1;
+
+    member.buffers.emplace_back(new storage(rounded));
+    member.front.store(0, std::memory_order_relaxed);
+    member.back.store(0, std::memory_order_relaxed);
+    member.buffer.store(member.buffers.back().get(), std::memory_order_relaxed);
+}
+
+template <typename T>
+work_stealing_deque<T>::~work_stealing_deque() = default;
+
+template <typename T>
+bool work_stealing_deque<T>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <typename T>
+auto work_stealing_deque<T>::size() const noexcept -> size_type
+{
+    const auto back = member.back.load(std::memory_order_relaxed);
+    const auto front = member.front.load(std::memory_order_relaxed);
+    return (back > front) ? size_type(back - front) : 0;
+}
+
+template <typename T>
+auto work_stealing_deque<T>::capacity() const noexcept -> size_type
+{
+    return member.buffer.load(std::memory_order_relaxed)->capacity();
+}
+
+template <typename T>
+void work_stealing_deque<T>::push_back(value_type input)
+{
+    const auto back = member.back.load(std::memory_order_relaxed);
+    const auto front = member.front.load(std::memory_order_acquire);
+    auto buffer = member.buffer.load(std::memory_order_relaxed);
+    if (back - front >= index_type(buffer->capacity()))
+    {
+        buffer = grow(buffer, front, back);
+    }
+    buffer->store(back, input);
+    std::atomic_thread_fence(std::memory_order_release);
+    member.back.store(back + 1, std::memory_order_relaxed);
+}
+
+template <typename T>
+bool work_stealing_deque<T>::try_pop_back(value_type& output) noexcept
+{
+    // Reserve the back element before inspecting the front so that a
+    // concurrent thief cannot take the same element unnoticed.
+    const auto back = member.back.load(std::memory_order_relaxed) - 1;
+    auto buffer = member.buffer.load(std::memory_order_relaxed);
+    member.back.store(back, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto front = member.front.load(std::memory_order_relaxed);
+
+    if (front > back)
+    {
+        // Empty
+        member.back.store(back + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    output = buffer->load(back);
+    if (front < back)
+        return true;
+
+    // Last element so race against thieves
+    const bool success = member.front.compare_exchange_strong(front,
+                                                              front + 1,
+                                                              std::memory_order_seq_cst,
+                                                              std::memory_order_relaxed);
+    member.back.store(back + 1, std::memory_order_relaxed);
+    return success;
+}
+
+template <typename T>
+bool work_stealing_deque<T>::try_steal_front(value_type& output) noexcept
+{
+    auto front = member.front.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto back = member.back.load(std::memory_order_acquire);
+
+    if (front >= back)
+        return false;
+
+    // The element must be read before the compare-and-swap, because the
+    // owner may overwrite the slot as soon as front has moved past it.
+    const auto buffer = member.buffer.load(std::memory_order_acquire);
+    output = buffer->load(front);
+    return member.front.compare_exchange_strong(front,
+                                                front + 1,
+                                                std::memory_order_seq_cst,
+                                                std::memory_order_relaxed);
+}
+
+template <typename T>
+auto work_stealing_deque<T>::grow(storage* buffer,
+                                  index_type front,
+                                  index_type back) -> storage*
+{
+    std::unique_ptr<storage> larger(new storage(2 * buffer->capacity()));
+    larger->assign(*buffer, front, back);
+    member.buffers.push_back(std::move(larger));
+    buffer = member.buffers.back().get();
+    member.buffer.store(buffer, std::memory_order_release);
+    return buffer;
+}
+
+} // namespace circular
+} // namespace trial
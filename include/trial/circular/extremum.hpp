@@ -0,0 +1,125 @@
+#ifndef TRIAL_CIRCULAR_EXTREMUM_HPP
+#define TRIAL_CIRCULAR_EXTREMUM_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <functional>
+#include <trial/circular/array.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+//! @brief Moving extremum over the N most recent values.
+//!
+//! The extremum is the value that is not ordered before any other value in
+//! the window according to @c Compare. With std::less this is the maximum.
+//!
+//! Besides the window of values, a monotonic queue of candidates is kept.
+//! Candidates are sequence numbers of values that may become the extremum
+//! when older values leave the window. Insertion has amortized constant time
+//! complexity, and the extremum is returned in constant time.
+
+template <typename T, std::size_t N, typename Compare = std::less<T>>
+class extremum
+{
+    static_assert(N > 0, "N must be greater than zero");
+
+    using window_type = circular::array<T, N>;
+
+public:
+    using value_type = typename window_type::value_type;
+    using size_type = typename window_type::size_type;
+    using const_reference = typename window_type::const_reference;
+    using const_iterator = typename window_type::const_iterator;
+    using value_compare = Compare;
+
+    //! @brief Creates empty moving extremum.
+
+    extremum() = default;
+
+    //! @brief Creates empty moving extremum with comparator.
+
+    explicit extremum(const value_compare&);
+
+    //! @brief Checks if window is empty.
+
+    bool empty() const noexcept;
+
+    //! @brief Checks if window is full.
+
+    bool full() const noexcept;
+
+    //! @brief Returns the number of values in window.
+
+    size_type size() const noexcept;
+
+    //! @brief Returns the maximum number of values in window.
+
+    constexpr size_type capacity() const noexcept;
+
+    //! @brief Clears the window.
+
+    void clear() noexcept;
+
+    //! @brief Appends value.
+    //!
+    //! If the window is full, then the oldest value is evicted.
+    //!
+    //! Amortized constant time complexity.
+
+    void push(value_type input);
+
+    //! @brief Returns the extremum of the window.
+    //!
+    //! Constant time complexity.
+    //!
+    //! @pre !empty()
+
+    const_reference value() const noexcept;
+
+    //! @brief Returns iterator to the oldest value in the window.
+
+    const_iterator begin() const noexcept;
+
+    //! @brief Returns iterator to the ending of the window.
+
+    const_iterator end() const noexcept;
+
+private:
+    const_reference at(size_type sequence) const noexcept;
+
+private:
+    window_type window;
+    // Sequence numbers of candidates ordered by age. The candidate values are
+    // ordered by Compare from back to front.
+    circular::array<size_type, N> candidates;
+    size_type sequence = 0;
+    value_compare compare = value_compare();
+};
+
+//! @brief Moving maximum over the N most recent values.
+
+template <typename T, std::size_t N>
+using window_max = extremum<T, N, std::less<T>>;
+
+//! @brief Moving minimum over the N most recent values.
+
+template <typename T, std::size_t N>
+using window_min = extremum<T, N, std::greater<T>>;
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/extremum.ipp>
+
+#endif // TRIAL_CIRCULAR_EXTREMUM_HPP
@@ -0,0 +1,128 @@
+#ifndef TRIAL_CIRCULAR_FIR_HPP
+#define TRIAL_CIRCULAR_FIR_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <trial/circular/detail/fft.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+//! @brief Finite impulse response filter with N coefficients.
+//!
+//! The output is the sum of the N most recent samples multiplied by the
+//! coefficients, where the first coefficient applies to the newest sample.
+//! Samples before the first pushed sample are zero.
+//!
+//! The samples are kept in a history buffer of twice the size, where each
+//! sample is stored both at its circular position and N positions later.
+//! The N most recent samples are therefore always contiguous, so the inner
+//! loops run over pointers without wrapping.
+//!
+//! Blocks of samples are filtered in the direct form one coefficient at a
+//! time across all outputs of the block, which the compiler can vectorize
+//! without reordering floating-point additions. For floating-point types with
+//! many coefficients, long blocks are filtered with overlap-save convolution
+//! via the fast Fourier transform instead.
+
+template <typename T, std::size_t N>
+class fir
+{
+    static_assert(std::is_arithmetic<T>::value, "T must be an arithmetic type");
+    static_assert(N > 0, "N must be greater than zero");
+
+    using overlap_type = detail::overlap_save<T, N>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    //! @brief Creates filter with coefficients.
+    //!
+    //! Missing coefficients are zero.
+    //!
+    //! @pre input.size() <= N
+
+    fir(std::initializer_list<value_type> input);
+
+    //! @brief Creates filter with coefficients from range.
+    //!
+    //! @pre std::distance(first, last) <= N
+
+    template <typename InputIterator>
+    fir(InputIterator first, InputIterator last);
+
+    //! @brief Returns the number of coefficients.
+
+    constexpr size_type size() const noexcept;
+
+    //! @brief Resets all samples to zero.
+
+    void clear() noexcept;
+
+    //! @brief Appends sample.
+
+    void push(value_type input) noexcept;
+
+    //! @brief Returns the filtered value of the most recent samples.
+    //!
+    //! Linear time complexity in N.
+
+    value_type value() const noexcept;
+
+    //! @brief Appends block of samples and writes filtered values to output.
+    //!
+    //! Equivalent to a push of each input sample followed by value(), except
+    //! for the rounding of floating-point operations. Input and output may be
+    //! the same.
+
+    void process(const value_type *input,
+                 value_type *output,
+                 size_type count);
+
+private:
+    void process(const value_type *&input,
+                 value_type *&output,
+                 size_type& count,
+                 std::true_type);
+    void process(const value_type *&,
+                 value_type *&,
+                 size_type&,
+                 std::false_type) noexcept;
+
+    void process_direct(const value_type *input,
+                        value_type *output,
+                        size_type count) noexcept;
+
+    void assign(const value_type *input) noexcept;
+
+private:
+    // Coefficients in reverse order, so the last coefficient applies to the
+    // newest sample like the history.
+    std::array<value_type, N> coefficients;
+    std::array<value_type, 2 * N> history;
+    // Position of the oldest sample
+    size_type next = 0;
+    overlap_type overlap;
+};
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/fir.ipp>
+
+#endif // TRIAL_CIRCULAR_FIR_HPP
@@ -0,0 +1,284 @@
+#ifndef TRIAL_CIRCULAR_INLINE_ARRAY_HPP
+#define TRIAL_CIRCULAR_INLINE_ARRAY_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <initializer_list>
+#include <trial/circular/span.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+//! @brief Fixed-sized circular buffer with self-relative addressing.
+//!
+//! Unlike circular::array, the storage address is not kept as a pointer but
+//! derived from the object itself. Only the position of the first element and
+//! the size are stored alongside the elements.
+//!
+//! The circular buffer is therefore trivially copyable when T is trivially
+//! copyable, so it can be copied with std::memcpy, for example into shared
+//! memory.
+//!
+//! Operations are forwarded to a circular span that is created on demand.
+//! Iterators and segments refer to the storage of the object and are
+//! invalidated when the object is copied or moved.
+
+template <typename T, std::size_t N, typename SizeType = std::size_t>
+class inline_array
+{
+    using span = circular::template span<T, N, SizeType>;
+
+    static_assert(std::is_destructible<T>::value, "T must be Erasable");
+    static_assert(std::is_default_constructible<T>::value, "T must be DefaultConstructible");
+    static_assert(N != dynamic_extent, "N cannot be dynamic_extent");
+
+public:
+    using element_type = typename span::element_type;
+    using value_type = typename span::value_type;
+    using size_type = typename span::size_type;
+    using reference = typename span::reference;
+    using const_reference = typename span::const_reference;
+    using iterator = typename span::iterator;
+    using const_iterator = typename span::const_iterator;
+    using reverse_iterator = typename span::reverse_iterator;
+    using const_reverse_iterator = typename span::const_reverse_iterator;
+    using segment = typename span::segment;
+    using const_segment = typename span::const_segment;
+    using segment_range = typename span::segment_range;
+    using const_segment_range = typename span::const_segment_range;
+
+    //! @brief Creates empty circular array.
+    //!
+    //! @post capacity() == N
+    //! @post size() == 0
+
+    inline_array() = default;
+
+    //! @brief Creates circular array with elements from initializer list.
+    //!
+    //! If input.size() > N then only the last N input elements will remain.
+
+    TRIAL_CXX14_CONSTEXPR
+    inline_array(std::initializer_list<value_type> input) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+
+    //! @brief Recreates circular array with elements from initializer list.
+
+    TRIAL_CXX14_CONSTEXPR
+    inline_array& operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+
+    //! @brief Checks if circular array is empty.
+
+    TRIAL_CXX14_CONSTEXPR
+    bool empty() const noexcept;
+
+    //! @brief Checks if circular array is full.
+
+    TRIAL_CXX14_CONSTEXPR
+    bool full() const noexcept;
+
+    //! @brief Returns the maximum possible number of elements in circular array.
+
+    constexpr size_type capacity() const noexcept;
+
+    //! @brief Returns the number of elements in circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    size_type size() const noexcept;
+
+    //! @brief Returns the maximum number of possible elements in circular array.
+
+    constexpr size_type max_size() const noexcept;
+
+    //! @brief Returns reference to first element in circular array.
+    //!
+    //! @pre !empty()
+
+    TRIAL_CXX14_CONSTEXPR
+    reference front() noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_reference front() const noexcept;
+
+    //! @brief Returns reference to last element in circular array.
+    //!
+    //! @pre !empty()
+
+    TRIAL_CXX14_CONSTEXPR
+    reference back() noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_reference back() const noexcept;
+
+    //! @brief Returns reference to element at position.
+    //!
+    //! @pre position < size()
+
+    TRIAL_CXX14_CONSTEXPR
+    reference operator[](size_type position) noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_reference operator[](size_type position) const noexcept;
+
+    //! @brief Clears the circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    void clear() noexcept;
+
+    //! @brief Clears circular array and inserts elements from range.
+
+    template <typename InputIterator>
+    TRIAL_CXX14_CONSTEXPR
+    void assign(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+
+    //! @brief Inserts element at beginning of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    void push_front(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Inserts element at end of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    void push_back(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Inserts elements from range at end of circular array.
+
+    template <typename InputIterator>
+    TRIAL_CXX14_CONSTEXPR
+    void push_back(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+
+    //! @brief Removes and returns element from beginning of circular array.
+    //!
+    //! @pre !empty()
+
+    TRIAL_CXX14_CONSTEXPR
+    value_type pop_front() noexcept(std::is_nothrow_move_constructible<value_type>::value);
+
+    //! @brief Removes and returns element from end of circular array.
+    //!
+    //! @pre !empty()
+
+    TRIAL_CXX14_CONSTEXPR
+    value_type pop_back() noexcept(std::is_nothrow_move_constructible<value_type>::value);
+
+    //! @brief Inserts unspecified elements at beginning of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    size_type expand_front(size_type count = 1U) noexcept;
+
+    //! @brief Inserts unspecified elements at end of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    size_type expand_back(size_type count = 1U) noexcept;
+
+    //! @brief Removes elements from beginning of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    void remove_front(size_type count = 1U) noexcept;
+
+    //! @brief Removes elements from end of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    void remove_back(size_type count = 1U) noexcept;
+
+    //! @brief Returns iterator to beginning of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    iterator begin() noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_iterator begin() const noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_iterator cbegin() const noexcept;
+
+    //! @brief Returns iterator to ending of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    iterator end() noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_iterator end() const noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_iterator cend() const noexcept;
+
+    //! @brief Returns reverse iterator to beginning of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    reverse_iterator rbegin() noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_reverse_iterator rbegin() const noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_reverse_iterator crbegin() const noexcept;
+
+    //! @brief Returns reverse iterator to ending of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    reverse_iterator rend() noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_reverse_iterator rend() const noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_reverse_iterator crend() const noexcept;
+
+    //! @brief Returns first contiguous segment of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    segment first_segment() noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_segment first_segment() const noexcept;
+
+    //! @brief Returns last contiguous segment of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    segment last_segment() noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_segment last_segment() const noexcept;
+
+    //! @brief Returns first contiguous unused segment of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    segment first_unused_segment() noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_segment first_unused_segment() const noexcept;
+
+    //! @brief Returns last contiguous unused segment of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    segment last_unused_segment() noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_segment last_unused_segment() const noexcept;
+
+    //! @brief Returns contiguous segments of circular array.
+
+    TRIAL_CXX14_CONSTEXPR
+    segment_range segments() noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const_segment_range segments() const noexcept;
+
+private:
+    TRIAL_CXX14_CONSTEXPR
+    span view() noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    const span view() const noexcept;
+    TRIAL_CXX14_CONSTEXPR
+    void update(const span&) noexcept;
+
+private:
+    value_type storage[N] = {};
+    struct
+    {
+        // Position of the first element in storage
+        size_type first;
+        size_type size;
+    } member = { 0, 0 };
+};
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/inline_array.ipp>
+
+#endif // TRIAL_CIRCULAR_INLINE_ARRAY_HPP
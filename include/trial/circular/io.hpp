@@ -0,0 +1,90 @@
+#ifndef TRIAL_CIRCULAR_IO_HPP
+#define TRIAL_CIRCULAR_IO_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <system_error>
+#include <trial/circular/iovec.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+// Streaming between POSIX file descriptors and circular byte buffers.
+//
+// Data is transferred directly to and from the segments of the circular
+// container, such as span<char>, array<char, N>, or vector<char>, without
+// intermediate copies.
+//
+// Interrupted system calls are restarted. If the file descriptor is
+// non-blocking and the operation would block, then the error is set to
+// std::errc::operation_would_block (or its equivalent
+// std::errc::resource_unavailable_try_again) and the number of bytes that
+// were transferred before is returned.
+
+//! @brief Reads from file descriptor into circular buffer.
+//!
+//! Reads as much as the unused segments can hold with a single readv() call.
+//! Elements in the buffer are never overwritten.
+//!
+//! Returns the number of bytes read. Zero is returned without error on
+//! end-of-file.
+//!
+//! @pre !buffer.full()
+
+template <typename Circular>
+std::size_t read_from(int fd,
+                      Circular& buffer,
+                      std::error_code& error) noexcept;
+
+//! @brief Receives from socket into circular buffer.
+//!
+//! Same as read_from() except that recvmsg() is called with @c flags.
+
+template <typename Circular>
+std::size_t read_from(int socket,
+                      Circular& buffer,
+                      int flags,
+                      std::error_code& error) noexcept;
+
+//! @brief Writes circular buffer to file descriptor.
+//!
+//! Writes the used segments with writev() and removes the written bytes from
+//! the buffer. Short writes are continued until the buffer is empty, the
+//! operation would block, or an error occurs. If writev() writes nothing,
+//! then the error is set to std::errc::io_error.
+//!
+//! Returns the number of bytes written.
+
+template <typename Circular>
+std::size_t write_to(int fd,
+                     Circular& buffer,
+                     std::error_code& error) noexcept;
+
+//! @brief Sends circular buffer to socket.
+//!
+//! Same as write_to() except that sendmsg() is called with @c flags, such as
+//! MSG_NOSIGNAL.
+
+template <typename Circular>
+std::size_t write_to(int socket,
+                     Circular& buffer,
+                     int flags,
+                     std::error_code& error) noexcept;
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/io.ipp>
+
+#endif // TRIAL_CIRCULAR_IO_HPP
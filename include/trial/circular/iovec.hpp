@@ -0,0 +1,83 @@
+#ifndef TRIAL_CIRCULAR_IOVEC_HPP
+#define TRIAL_CIRCULAR_IOVEC_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <sys/uio.h>
+#include <trial/circular/detail/config.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+// Scatter/gather I/O vectors for POSIX readv(), writev(), recvmsg(), and sendmsg().
+//
+// The functions operate on any circular container with segments, such as
+// span, array, and vector. The element type must be trivially copyable.
+//
+// The length of the I/O vectors is measured in bytes, whereas consume() and
+// produce() count elements. Partial transfers of elements larger than a byte
+// must be converted by the caller.
+
+//! @brief Fills I/O vector with used segments of circular container.
+//!
+//! The used segments contains the elements that can be written by writev() or
+//! sendmsg() in the order they were inserted.
+//!
+//! Returns the number of non-empty entries in the I/O vector.
+//!
+//! @post The first returned entries of output covers all elements.
+
+template <typename Circular>
+std::size_t used_iovec(Circular& buffer,
+                       struct iovec (&output)[2]) noexcept;
+
+//! @brief Fills I/O vector with unused segments of circular container.
+//!
+//! The unused segments covers the free space that can be filled by readv() or
+//! recvmsg() without overwriting any elements.
+//!
+//! Returns the number of non-empty entries in the I/O vector.
+
+template <typename Circular>
+std::size_t unused_iovec(Circular& buffer,
+                         struct iovec (&output)[2]) noexcept;
+
+//! @brief Removes elements that have been written from used segments.
+//!
+//! @pre count <= buffer.size()
+//! @post size() == old size() - count
+
+template <typename Circular>
+TRIAL_CXX14_CONSTEXPR
+void consume(Circular& buffer,
+             typename Circular::size_type count) noexcept;
+
+//! @brief Appends elements that have been read into unused segments.
+//!
+//! Elements are never overwritten.
+//!
+//! @pre count <= buffer.capacity() - buffer.size()
+//! @post size() == old size() + count
+
+template <typename Circular>
+TRIAL_CXX14_CONSTEXPR
+void produce(Circular& buffer,
+             typename Circular::size_type count) noexcept;
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/iovec.ipp>
+
+#endif // TRIAL_CIRCULAR_IOVEC_HPP
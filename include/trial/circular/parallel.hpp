@@ -0,0 +1,178 @@
+#ifndef TRIAL_CIRCULAR_PARALLEL_HPP
+#define TRIAL_CIRCULAR_PARALLEL_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <type_traits>
+#include <trial/circular/detail/config.hpp>
+
+// Overloads for the standard execution policies are enabled by defining
+// TRIAL_CIRCULAR_EXECUTION=1. They are opt-in because some standard libraries
+// require linking with a parallel backend, such as TBB, once <execution> is
+// included.
+
+#if !defined(TRIAL_CIRCULAR_EXECUTION)
+# define TRIAL_CIRCULAR_EXECUTION 0
+#endif
+
+#if TRIAL_CIRCULAR_EXECUTION
+# include <execution>
+#endif
+
+namespace trial
+{
+namespace circular
+{
+
+// Parallel algorithms over circular containers.
+//
+// The functions operate on any circular container with segments, such as
+// span, array, and vector. The elements are split into balanced chunks, and
+// consecutive chunks are processed by separate threads. Each chunk covers at
+// most two contiguous pieces of the segments, so the inner loops run over
+// pointers.
+
+//! @brief Execution policy that processes chunks with std::thread.
+//!
+//! The number of chunks only depends on the number of elements and the
+//! grain, not on the number of threads, and partial results are combined in
+//! chunk order. The result of a reduction is therefore the same on any
+//! machine even for non-associative operations such as floating-point
+//! addition.
+
+class chunked_policy
+{
+public:
+    //! @brief Creates policy.
+    //!
+    //! Zero threads means the number of hardware threads. Each chunk has at
+    //! least grain elements, so small containers use fewer threads.
+    //!
+    //! The grain decides how elements are grouped in reductions, so it must
+    //! be the same for reproducible results.
+
+    explicit chunked_policy(std::size_t threads = 0,
+                            std::size_t grain = 4096) noexcept;
+
+    //! @brief Returns the maximum number of threads.
+
+    std::size_t threads() const noexcept;
+
+    //! @brief Returns the minimum number of elements per chunk.
+
+    std::size_t grain() const noexcept;
+
+    //! @brief Returns the number of chunks used for size elements.
+    //!
+    //! Independent of the number of threads.
+
+    std::size_t chunks(std::size_t size) const noexcept;
+
+private:
+    struct
+    {
+        std::size_t threads;
+        std::size_t grain;
+    } member;
+};
+
+//! @brief Reduces elements in chunk order.
+//!
+//! Each chunk is left-folded with reduce, and the partial results are
+//! left-folded onto init in chunk order.
+//!
+//! Exceptions thrown by reduce are propagated to the caller.
+
+template <typename Circular, typename T, typename BinaryOperation>
+T reduce(const chunked_policy& policy,
+         Circular& buffer,
+         T init,
+         BinaryOperation reduce);
+
+template <typename Circular, typename T>
+T reduce(const chunked_policy& policy,
+         Circular& buffer,
+         T init);
+
+//! @brief Transforms and reduces elements in chunk order.
+//!
+//! @sa reduce
+
+template <typename Circular, typename T, typename BinaryOperation, typename UnaryOperation>
+T transform_reduce(const chunked_policy& policy,
+                   Circular& buffer,
+                   T init,
+                   BinaryOperation reduce,
+                   UnaryOperation transform);
+
+//! @brief Copies elements into random access output.
+//!
+//! @returns Iterator past the last copied element.
+
+template <typename Circular, typename RandomAccessIterator>
+RandomAccessIterator copy(const chunked_policy& policy,
+                          Circular& buffer,
+                          RandomAccessIterator output);
+
+#if TRIAL_CIRCULAR_EXECUTION
+
+// The standard execution policies are applied to each segment.
+
+namespace detail
+{
+
+template <typename ExecutionPolicy>
+using enable_if_execution_policy = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, int>::type;
+
+} // namespace detail
+
+//! @brief Reduces elements with standard execution policy.
+
+template <typename ExecutionPolicy, typename Circular, typename T, typename BinaryOperation,
+          detail::enable_if_execution_policy<ExecutionPolicy> = 0>
+T reduce(ExecutionPolicy&& policy,
+         Circular& buffer,
+         T init,
+         BinaryOperation reduce);
+
+template <typename ExecutionPolicy, typename Circular, typename T,
+          detail::enable_if_execution_policy<ExecutionPolicy> = 0>
+T reduce(ExecutionPolicy&& policy,
+         Circular& buffer,
+         T init);
+
+//! @brief Transforms and reduces elements with standard execution policy.
+
+template <typename ExecutionPolicy, typename Circular, typename T, typename BinaryOperation, typename UnaryOperation,
+          detail::enable_if_execution_policy<ExecutionPolicy> = 0>
+T transform_reduce(ExecutionPolicy&& policy,
+                   Circular& buffer,
+                   T init,
+                   BinaryOperation reduce,
+                   UnaryOperation transform);
+
+//! @brief Copies elements with standard execution policy.
+
+template <typename ExecutionPolicy, typename Circular, typename RandomAccessIterator,
+          detail::enable_if_execution_policy<ExecutionPolicy> = 0>
+RandomAccessIterator copy(ExecutionPolicy&& policy,
+                          Circular& buffer,
+                          RandomAccessIterator output);
+
+#endif
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/parallel.ipp>
+
+#endif // TRIAL_CIRCULAR_PARALLEL_HPP
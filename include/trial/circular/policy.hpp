@@ -0,0 +1,166 @@
+#ifndef TRIAL_CIRCULAR_POLICY_HPP
+#define TRIAL_CIRCULAR_POLICY_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <trial/circular/detail/config.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+//! @brief Behavior of insertion into a full container.
+
+enum class overflow_policy
+{
+    //! @brief Oldest elements at the opposite end are overwritten.
+    overwrite,
+    //! @brief New elements are discarded.
+    reject,
+    //! @brief Insertion into a full container is a precondition violation.
+    //!
+    //! Checked by assertions, so elements are overwritten when assertions
+    //! are disabled.
+    assertion
+};
+
+namespace policy
+{
+
+//! @brief Default policy.
+//!
+//! A policy customizes circular containers via hooks that are called when
+//! elements are inserted or removed. The container derives from its policy,
+//! so an empty policy adds nothing to the size of the container, and empty
+//! hooks are optimized away.
+//!
+//! Custom policies should derive from this policy and hide the hooks they
+//! need. Hooks must not throw.
+
+struct basic
+{
+    //! @brief Behavior of push_back() and push_front() when full.
+
+    static constexpr overflow_policy overflow = overflow_policy::overwrite;
+
+    //! @brief Called after count elements have been inserted.
+    //!
+    //! The size parameter is the number of elements after insertion.
+
+    TRIAL_CXX14_CONSTEXPR
+    void on_push(std::size_t /* count */, std::size_t /* size */) noexcept {}
+
+    //! @brief Called after count elements have been removed.
+
+    TRIAL_CXX14_CONSTEXPR
+    void on_pop(std::size_t /* count */) noexcept {}
+
+    //! @brief Called before count elements are overwritten by insertion.
+
+    TRIAL_CXX14_CONSTEXPR
+    void on_overwrite(std::size_t /* count */) noexcept {}
+
+    //! @brief Called with elements before they are overwritten by insertion.
+    //!
+    //! The segment is a contiguous range of the evicted elements, which can
+    //! be moved elsewhere. Elements that wrap around the end of the storage
+    //! are passed in two calls.
+
+    template <typename Segment>
+    TRIAL_CXX14_CONSTEXPR
+    void on_evict(Segment /* segment */) noexcept {}
+
+    //! @brief Called when insertion wraps around the end of the storage.
+
+    TRIAL_CXX14_CONSTEXPR
+    void on_wraparound() noexcept {}
+};
+
+//! @brief Policy that discards new elements when full.
+
+struct reject
+    : basic
+{
+    static constexpr overflow_policy overflow = overflow_policy::reject;
+};
+
+//! @brief Policy that counts operations.
+//!
+//! The counters are available via the stats() member function of the
+//! container.
+
+class statistics
+    : public basic
+{
+public:
+    struct counters
+    {
+        //! @brief Number of inserted elements.
+        std::size_t pushes;
+        //! @brief Number of removed elements.
+        std::size_t pops;
+        //! @brief Number of elements overwritten by insertion.
+        std::size_t overwrites;
+        //! @brief Number of times insertion has wrapped around the storage.
+        std::size_t wraparounds;
+        //! @brief Largest number of elements.
+        std::size_t high_water;
+    };
+
+    constexpr statistics() noexcept
+        : data{0, 0, 0, 0, 0}
+    {
+    }
+
+    //! @brief Returns counters.
+
+    constexpr const counters& stats() const noexcept
+    {
+        return data;
+    }
+
+    TRIAL_CXX14_CONSTEXPR
+    void on_push(std::size_t count, std::size_t size) noexcept
+    {
+        data.pushes += count;
+        if (size > data.high_water)
+            data.high_water = size;
+    }
+
+    TRIAL_CXX14_CONSTEXPR
+    void on_pop(std::size_t count) noexcept
+    {
+        data.pops += count;
+    }
+
+    TRIAL_CXX14_CONSTEXPR
+    void on_overwrite(std::size_t count) noexcept
+    {
+        data.overwrites += count;
+    }
+
+    TRIAL_CXX14_CONSTEXPR
+    void on_wraparound() noexcept
+    {
+        ++data.wraparounds;
+    }
+
+private:
+    counters data;
+};
+
+} // namespace policy
+} // namespace circular
+} // namespace trial
+
+#endif // TRIAL_CIRCULAR_POLICY_HPP
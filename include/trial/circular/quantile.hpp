@@ -0,0 +1,266 @@
+#ifndef TRIAL_CIRCULAR_QUANTILE_HPP
+#define TRIAL_CIRCULAR_QUANTILE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+#include <trial/circular/detail/window.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+//! @brief Moving quantile over the most recent values.
+//!
+//! Quantiles are calculated with the nearest-rank method over a window of the
+//! most recent values. The window is a circular array when N is given, or a
+//! circular vector when N is dynamic_extent.
+//!
+//! The values are also kept in an order-statistic tree, which is a treap where
+//! each node counts the values in its subtree. The nodes are preallocated with
+//! one node per position in the window, so the node of the evicted value is
+//! known without searching. Insertion, eviction, and quantile queries have
+//! expected logarithmic time complexity.
+
+template <typename T, std::size_t N = dynamic_extent, typename Compare = std::less<T>>
+class quantile
+{
+    using window_type = detail::window<T, N>;
+
+public:
+    using value_type = typename window_type::value_type;
+    using size_type = typename window_type::size_type;
+    using const_reference = typename window_type::const_reference;
+    using const_iterator = typename window_type::const_iterator;
+    using value_compare = Compare;
+
+    //! @brief Creates empty moving quantile with fixed capacity N.
+    //!
+    //! @post capacity() == N
+
+    template <std::size_t M = N,
+              typename std::enable_if<M != dynamic_extent, int>::type = 0>
+    explicit quantile(const value_compare& = value_compare());
+
+    //! @brief Creates empty moving quantile with capacity.
+    //!
+    //! @pre capacity > 0
+    //! @post capacity() == capacity
+
+    template <std::size_t M = N,
+              typename std::enable_if<M == dynamic_extent, int>::type = 0>
+    explicit quantile(size_type capacity,
+                      const value_compare& = value_compare());
+
+    //! @brief Checks if window is empty.
+
+    bool empty() const noexcept;
+
+    //! @brief Checks if window is full.
+
+    bool full() const noexcept;
+
+    //! @brief Returns the number of values in window.
+
+    size_type size() const noexcept;
+
+    //! @brief Returns the maximum number of values in window.
+
+    size_type capacity() const noexcept;
+
+    //! @brief Clears the window.
+
+    void clear() noexcept;
+
+    //! @brief Appends value.
+    //!
+    //! If the window is full, then the oldest value is evicted.
+    //!
+    //! Expected logarithmic time complexity.
+
+    void push(value_type input);
+
+    //! @brief Returns quantile of values in window.
+    //!
+    //! For example, value(0.5) returns the median and value(0.99) returns the
+    //! 99th percentile.
+    //!
+    //! Expected logarithmic time complexity.
+    //!
+    //! @pre !empty()
+    //! @pre 0 <= probability <= 1
+
+    const_reference value(double probability) const noexcept;
+
+    //! @brief Returns the k-th smallest value in window.
+    //!
+    //! Expected logarithmic time complexity.
+    //!
+    //! @pre position < size()
+
+    const_reference order(size_type position) const noexcept;
+
+    //! @brief Returns iterator to the oldest value in the window.
+
+    const_iterator begin() const noexcept;
+
+    //! @brief Returns iterator to the ending of the window.
+
+    const_iterator end() const noexcept;
+
+private:
+    struct node_type
+    {
+        value_type value;
+        size_type left;
+        size_type right;
+        size_type count;
+        std::uint32_t priority;
+    };
+
+    // Node zero is the empty tree
+    using index_type = typename std::conditional<N == dynamic_extent,
+                                                 std::vector<node_type>,
+                                                 std::array<node_type, (N == dynamic_extent) ? 1 : N + 1>>::type;
+
+    bool before(size_type lhs, size_type rhs) const;
+    void recount(size_type node) noexcept;
+    void split(size_type tree, size_type key, size_type& lower, size_type& upper);
+    size_type insert(size_type tree, size_type node);
+    size_type erase(size_type tree, size_type node);
+    size_type merge(size_type lower, size_type upper) noexcept;
+
+private:
+    window_type window;
+    index_type nodes;
+    size_type root = 0;
+    // Number of pushed values, used to select the node of the next value
+    size_type sequence = 0;
+    value_compare compare;
+};
+
+//! @brief Moving quantile over bounded integers.
+//!
+//! Values are counted in a histogram with one bucket per integer in the domain
+//! from zero to @c limit. The histogram is a Fenwick tree, so insertion,
+//! eviction, and quantile queries have logarithmic time complexity in the size
+//! of the domain, regardless of the window size. Quantiles are exact.
+//!
+//! Values outside the domain are saturated to limit - 1.
+
+template <typename T, std::size_t N = dynamic_extent>
+class histogram_quantile
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral type");
+
+    using window_type = detail::window<T, N>;
+
+public:
+    using value_type = typename window_type::value_type;
+    using size_type = typename window_type::size_type;
+    using const_iterator = typename window_type::const_iterator;
+
+    //! @brief Creates empty moving quantile with fixed capacity N.
+    //!
+    //! @pre limit > 0
+    //! @post capacity() == N
+
+    template <std::size_t M = N,
+              typename std::enable_if<M != dynamic_extent, int>::type = 0>
+    explicit histogram_quantile(value_type limit);
+
+    //! @brief Creates empty moving quantile with capacity.
+    //!
+    //! @pre capacity > 0
+    //! @pre limit > 0
+    //! @post capacity() == capacity
+
+    template <std::size_t M = N,
+              typename std::enable_if<M == dynamic_extent, int>::type = 0>
+    histogram_quantile(size_type capacity,
+                       value_type limit);
+
+    //! @brief Checks if window is empty.
+
+    bool empty() const noexcept;
+
+    //! @brief Checks if window is full.
+
+    bool full() const noexcept;
+
+    //! @brief Returns the number of values in window.
+
+    size_type size() const noexcept;
+
+    //! @brief Returns the maximum number of values in window.
+
+    size_type capacity() const noexcept;
+
+    //! @brief Returns the upper limit of the domain.
+
+    value_type limit() const noexcept;
+
+    //! @brief Clears the window.
+
+    void clear() noexcept;
+
+    //! @brief Appends value.
+    //!
+    //! If the window is full, then the oldest value is evicted.
+    //!
+    //! Logarithmic time complexity in the size of the domain.
+
+    void push(value_type input);
+
+    //! @brief Returns quantile of values in window.
+    //!
+    //! Logarithmic time complexity in the size of the domain.
+    //!
+    //! @pre !empty()
+    //! @pre 0 <= probability <= 1
+
+    value_type value(double probability) const noexcept;
+
+    //! @brief Returns the k-th smallest value in window.
+    //!
+    //! @pre position < size()
+
+    value_type order(size_type position) const noexcept;
+
+    //! @brief Returns iterator to the oldest value in the window.
+
+    const_iterator begin() const noexcept;
+
+    //! @brief Returns iterator to the ending of the window.
+
+    const_iterator end() const noexcept;
+
+private:
+    void update(size_type bucket, size_type delta) noexcept;
+
+private:
+    window_type window;
+    // Fenwick tree with one-based indexing
+    std::vector<size_type> tree;
+    value_type upper;
+};
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/quantile.ipp>
+
+#endif // TRIAL_CIRCULAR_QUANTILE_HPP
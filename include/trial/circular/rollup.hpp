@@ -0,0 +1,181 @@
+#ifndef TRIAL_CIRCULAR_ROLLUP_HPP
+#define TRIAL_CIRCULAR_ROLLUP_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <trial/circular/array.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+// Aggregators for rollup.
+//
+// An aggregator converts a sample into an aggregate with lift(), and combines
+// an older and a newer aggregate with merge().
+
+namespace aggregate
+{
+
+struct sum
+{
+    template <typename T>
+    static T lift(const T& sample) { return sample; }
+
+    template <typename T>
+    static T merge(const T& older, const T& newer) { return older + newer; }
+};
+
+struct count
+{
+    template <typename T>
+    static T lift(const T&) { return T(1); }
+
+    template <typename T>
+    static T merge(const T& older, const T& newer) { return older + newer; }
+};
+
+struct min
+{
+    template <typename T>
+    static T lift(const T& sample) { return sample; }
+
+    template <typename T>
+    static T merge(const T& older, const T& newer) { return (newer < older) ? newer : older; }
+};
+
+struct max
+{
+    template <typename T>
+    static T lift(const T& sample) { return sample; }
+
+    template <typename T>
+    static T merge(const T& older, const T& newer) { return (older < newer) ? newer : older; }
+};
+
+struct last
+{
+    template <typename T>
+    static T lift(const T& sample) { return sample; }
+
+    template <typename T>
+    static T merge(const T&, const T& newer) { return newer; }
+};
+
+} // namespace aggregate
+
+//! @brief Multi-resolution round-robin database.
+//!
+//! Samples are aggregated into a cascade of circular arrays with decreasing
+//! resolution. The first level holds the N1 most recent samples. Each entry
+//! of a coarser level holds the aggregate of a completed bucket of entries
+//! from the previous level, where the bucket size is the capacity of the
+//! previous level.
+//!
+//! For example, rollup<T, Agg, 60, 60, 24> with one sample per second keeps
+//! the last 60 seconds, the last 60 minutes, and the last 24 hours.
+//!
+//! Memory is fixed at compile time. Insertion has amortized constant time
+//! complexity.
+
+template <typename T, typename Aggregator, std::size_t... Ns>
+class rollup
+{
+    static_assert(sizeof...(Ns) > 0, "At least one level is required");
+
+    using levels_type = std::tuple<circular::array<T, Ns>...>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using aggregator_type = Aggregator;
+
+    template <std::size_t I>
+    using level_type = typename std::tuple_element<I, levels_type>::type;
+
+    //! @brief Creates empty rollup.
+
+    rollup() = default;
+
+    //! @brief Checks if rollup is empty.
+
+    bool empty() const noexcept;
+
+    //! @brief Clears all levels.
+
+    void clear() noexcept;
+
+    //! @brief Appends sample.
+    //!
+    //! Completed buckets are aggregated into coarser levels.
+    //!
+    //! Amortized constant time complexity.
+
+    void push(value_type input);
+
+    //! @brief Returns the aggregate of the most recent samples.
+    //!
+    //! Samples beyond the first level are taken from coarser levels, so the
+    //! number of samples is rounded up to the bucket granularity of the level
+    //! that covers them. The number of samples is also limited by the history
+    //! retained by the coarsest level.
+    //!
+    //! @pre !empty()
+    //! @pre samples > 0
+
+    value_type query(size_type samples) const;
+
+    //! @brief Returns a level.
+    //!
+    //! Level 0 contains the aggregated samples.
+
+    template <std::size_t I>
+    const level_type<I>& level() const noexcept;
+
+private:
+    template <std::size_t I>
+    using is_last = std::integral_constant<bool, I + 1 == sizeof...(Ns)>;
+
+    template <std::size_t I>
+    void push_level(value_type, std::false_type);
+    template <std::size_t I>
+    void push_level(value_type, std::true_type);
+
+    template <std::size_t I>
+    void clear_level(std::false_type) noexcept;
+    template <std::size_t I>
+    void clear_level(std::true_type) noexcept;
+
+    template <std::size_t I>
+    value_type query_level(size_type, std::false_type) const;
+    template <std::size_t I>
+    value_type query_level(size_type, std::true_type) const;
+
+    template <std::size_t I>
+    value_type merge_back(size_type) const;
+
+private:
+    levels_type levels;
+    // Number of entries and aggregate of the incomplete bucket per level.
+    std::array<size_type, sizeof...(Ns)> pending_count = {};
+    std::array<value_type, sizeof...(Ns)> pending = {};
+};
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/rollup.ipp>
+
+#endif // TRIAL_CIRCULAR_ROLLUP_HPP
@@ -0,0 +1,122 @@
+#ifndef TRIAL_CIRCULAR_SNAPSHOT_RING_HPP
+#define TRIAL_CIRCULAR_SNAPSHOT_RING_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <type_traits>
+#include <trial/circular/span.hpp>
+#include <trial/circular/array.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+//! @brief Fixed-sized circular buffer with lock-free snapshots.
+//!
+//! A single writer appends values and never blocks. Any number of readers take
+//! consistent snapshots of the N most recent values without blocking the
+//! writer.
+//!
+//! The ring is protected by a sequence lock. The writer makes the sequence odd
+//! while it modifies the ring, and even when done. Readers copy the segments of
+//! the ring optimistically, and retry if the sequence was odd or changed during
+//! the copy.
+//!
+//! The circular state is derived from the sequence, so readers never observe a
+//! partially updated state.
+//!
+//! @tparam T Value type, which must be trivially copyable.
+//! @tparam N Maximum number of values.
+
+template <typename T, std::size_t N>
+class snapshot_ring
+{
+    static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+    static_assert(N > 0, "N must be positive");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using sequence_type = std::uint64_t;
+    using snapshot_type = circular::array<value_type, N>;
+
+    //! @brief Creates empty ring.
+
+    snapshot_ring() noexcept;
+
+    snapshot_ring(const snapshot_ring&) = delete;
+    snapshot_ring& operator=(const snapshot_ring&) = delete;
+
+    //! @brief Returns the maximum number of values in ring.
+
+    static constexpr size_type capacity() noexcept { return N; }
+
+    //! @brief Returns the number of values appended to ring.
+
+    sequence_type count() const noexcept;
+
+    //! @brief Appends value.
+    //!
+    //! If the ring is full, then the oldest value is overwritten.
+    //!
+    //! Must only be called by the writer.
+    //!
+    //! Constant time complexity.
+
+    void push(value_type input) noexcept;
+
+    //! @brief Copies the values from oldest to newest into output.
+    //!
+    //! Retries until the copy is consistent.
+    //!
+    //! @pre output has room for capacity() values
+    //! @returns Number of copied values.
+
+    size_type snapshot(value_type *output) const noexcept;
+
+    //! @brief Returns a consistent copy of the values.
+
+    snapshot_type snapshot() const noexcept;
+
+    //! @brief Copies the values from oldest to newest into output once.
+    //!
+    //! The number of copied values is stored in size, which may be zero if
+    //! the ring is empty. The output and size are only valid if true is
+    //! returned.
+    //!
+    //! @pre output has room for capacity() values
+    //! @returns true if the copy was consistent, false if it must be retried.
+
+    bool try_snapshot(value_type *output, size_type& size) const noexcept;
+
+private:
+    using view_type = circular::span<const value_type, N>;
+
+    view_type view(sequence_type count) const noexcept;
+
+    struct
+    {
+        // Twice the number of appended values, plus one during writing
+        std::atomic<sequence_type> sequence;
+        value_type storage[N];
+    } member;
+};
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/snapshot_ring.ipp>
+
+#endif // TRIAL_CIRCULAR_SNAPSHOT_RING_HPP
@@ -0,0 +1,219 @@
+#ifndef TRIAL_CIRCULAR_SOA_HPP
+#define TRIAL_CIRCULAR_SOA_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <trial/circular/span.hpp>
+#include <trial/circular/detail/type_traits.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+//! @brief Circular buffer with structure-of-arrays layout.
+//!
+//! Each element consists of one value per column, and each column is stored
+//! in its own contiguous storage. A single circular state is shared by all
+//! columns, so insertion and removal apply to all columns at once.
+//!
+//! Columns are accessed as circular spans whose segments can be processed
+//! one column at a time.
+//!
+//! The column storage is embedded if N is given, or allocated with fixed
+//! capacity at construction if N is dynamic_extent.
+
+template <std::size_t N, typename... Ts>
+class soa
+{
+    static_assert(sizeof...(Ts) > 0, "At least one column is required");
+
+    template <typename T>
+    using storage_type = typename std::conditional<N == dynamic_extent,
+                                                   std::vector<T>,
+                                                   std::array<T, (N == dynamic_extent) ? 1 : N>>::type;
+    using columns_type = std::tuple<storage_type<Ts>...>;
+    using state_type = circular::span<typename std::tuple_element<0, std::tuple<Ts...>>::type, N>;
+
+public:
+    using value_type = std::tuple<Ts...>;
+    using size_type = typename state_type::size_type;
+
+    template <std::size_t I>
+    using column_type = typename std::tuple_element<I, value_type>::type;
+
+    template <std::size_t I>
+    using column_span = circular::span<column_type<I>, N>;
+
+    template <std::size_t I>
+    using const_column_span = circular::span<const column_type<I>, N>;
+
+    //! @brief Creates empty circular buffer with capacity N.
+    //!
+    //! @post capacity() == N
+
+    template <std::size_t M = N,
+              typename std::enable_if<M != dynamic_extent, int>::type = 0>
+    soa();
+
+    //! @brief Creates empty circular buffer with capacity.
+    //!
+    //! @post capacity() == capacity
+
+    template <std::size_t M = N,
+              typename std::enable_if<M == dynamic_extent, int>::type = 0>
+    explicit soa(size_type capacity);
+
+    //! @brief Creates circular buffer by copying.
+
+    soa(const soa& other);
+
+    //! @brief Creates circular buffer by moving.
+    //!
+    //! The moved-from circular buffer is empty. Its capacity is unchanged if
+    //! the column storage is embedded, and otherwise zero.
+
+    soa(soa&& other);
+
+    //! @brief Recreates circular buffer by copying.
+
+    soa& operator=(const soa& other);
+
+    //! @brief Recreates circular buffer by moving.
+    //!
+    //! The moved-from circular buffer is empty. Its capacity is unchanged if
+    //! the column storage is embedded, and otherwise zero.
+
+    soa& operator=(soa&& other);
+
+    //! @brief Checks if circular buffer is empty.
+
+    bool empty() const noexcept;
+
+    //! @brief Checks if circular buffer is full.
+
+    bool full() const noexcept;
+
+    //! @brief Returns the number of elements in circular buffer.
+
+    size_type size() const noexcept;
+
+    //! @brief Returns the maximum number of elements in circular buffer.
+
+    size_type capacity() const noexcept;
+
+    //! @brief Clears the circular buffer.
+    //!
+    //! @post size() == 0
+
+    void clear() noexcept;
+
+    //! @brief Inserts element at the beginning.
+    //!
+    //! If the circular buffer is full, then the element at the end is
+    //! overwritten.
+    //!
+    //! The inputs are moved into the columns after they have been passed, so
+    //! column types must be nothrow move assignable. A failure to copy an
+    //! input therefore leaves the circular buffer unchanged.
+    //!
+    //! @pre capacity() > 0
+
+    void push_front(Ts... inputs);
+
+    //! @brief Inserts element at the end.
+    //!
+    //! If the circular buffer is full, then the element at the beginning is
+    //! overwritten.
+    //!
+    //! The inputs are moved into the columns after they have been passed, so
+    //! column types must be nothrow move assignable. A failure to copy an
+    //! input therefore leaves the circular buffer unchanged.
+    //!
+    //! @pre capacity() > 0
+
+    void push_back(Ts... inputs);
+
+    //! @brief Removes elements from the beginning.
+    //!
+    //! @pre count <= size()
+
+    void remove_front(size_type count = 1U) noexcept;
+
+    //! @brief Removes elements from the end.
+    //!
+    //! @pre count <= size()
+
+    void remove_back(size_type count = 1U) noexcept;
+
+    //! @brief Returns element at position as tuple.
+    //!
+    //! @pre position < size()
+
+    value_type operator[](size_type position) const;
+
+    //! @brief Returns circular span of column.
+    //!
+    //! The span refers to the current elements of the column. It is
+    //! invalidated when elements are inserted or removed.
+
+    template <std::size_t I>
+    column_span<I> column() noexcept;
+
+    template <std::size_t I>
+    const_column_span<I> column() const noexcept;
+
+    //! @brief Returns contiguous segments of column.
+
+    template <std::size_t I>
+    typename column_span<I>::segment_range segments() noexcept;
+
+    template <std::size_t I>
+    typename const_column_span<I>::segment_range segments() const noexcept;
+
+private:
+    soa(columns_type&&, size_type offset, size_type length);
+
+    size_type front_offset() const noexcept;
+    size_type offset(const typename state_type::value_type&) const noexcept;
+    state_type make_state(size_type offset, size_type length) noexcept;
+
+    template <std::size_t... Is, typename... Args>
+    void assign(size_type, detail::index_sequence<Is...>, Args&&...);
+
+    template <std::size_t... Is>
+    value_type at(size_type, detail::index_sequence<Is...>) const;
+
+private:
+    columns_type columns;
+    state_type state;
+};
+
+//! @brief Fixed-sized circular buffer with structure-of-arrays layout.
+
+template <std::size_t N, typename... Ts>
+using soa_array = soa<N, Ts...>;
+
+//! @brief Circular buffer with structure-of-arrays layout and dynamic capacity.
+
+template <typename... Ts>
+using soa_vector = soa<dynamic_extent, Ts...>;
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/soa.ipp>
+
+#endif // TRIAL_CIRCULAR_SOA_HPP
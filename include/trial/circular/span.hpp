@@ -17,7 +17,9 @@
 #include <limits>
 #include <trial/circular/detail/config.hpp>
 #include <trial/circular/detail/type_traits.hpp>
+#include <trial/circular/detail/utility.hpp>
 #include <trial/circular/detail/segment.hpp>
+#include <trial/circular/policy.hpp>
 
 namespace trial
 {
@@ -37,28 +39,66 @@ namespace circular
 //! Capacity is the maximum number of elements that can be inserted without
 //! overwriting old elements. Capacity cannot be changed.
 //!
+//! SizeType is the unsigned type used for sizes and indices. A narrow type,
+//! such as std::uint16_t, reduces the footprint of the span and its iterators
+//! but limits the capacity to less than half of its maximum value.
+//!
+//! Policy provides hooks that are called when elements are inserted or
+//! removed. The default policy::basic does nothing and takes up no space.
+//!
 //! Violation of any precondition results in undefined behavior.
 
 enum : std::size_t { dynamic_extent = std::numeric_limits<std::size_t>::max() };
 
-template <typename T, std::size_t Extent = dynamic_extent>
+template <typename T,
+          std::size_t Extent = dynamic_extent,
+          typename SizeType = std::size_t,
+          typename Policy = policy::basic>
 class span
+    : protected Policy
 {
-    static_assert(Extent == dynamic_extent || Extent < std::numeric_limits<std::size_t>::max() / 2,
-                  "Extent is too large");
+    static_assert(std::is_integral<SizeType>::value && std::is_unsigned<SizeType>::value,
+                  "SizeType must be an unsigned integral type");
+    static_assert(Extent == dynamic_extent || Extent < std::size_t(std::numeric_limits<SizeType>::max()) / 2,
+                  "Extent is too large for SizeType");
 
 public:
     using element_type = T;
     using value_type = typename std::remove_cv<element_type>::type;
-    using size_type = std::size_t;
+    using size_type = SizeType;
     using pointer = typename std::add_pointer<element_type>::type;
     using reference = typename std::add_lvalue_reference<element_type>::type;
     using const_reference = typename std::add_lvalue_reference<typename std::add_const<element_type>::type>::type;
 
 private:
-    template <typename, std::size_t>
+    template <typename, std::size_t, typename, typename>
     friend class span;
 
+    template <typename Pointer, std::size_t E1>
+    struct iterator_storage
+    {
+        constexpr iterator_storage() noexcept;
+        constexpr iterator_storage(Pointer data, size_type capacity, size_type current) noexcept;
+
+        constexpr size_type capacity() const noexcept;
+
+        Pointer data;
+        size_type current;
+    };
+
+    template <typename Pointer>
+    struct iterator_storage<Pointer, dynamic_extent>
+    {
+        constexpr iterator_storage() noexcept;
+        constexpr iterator_storage(Pointer data, size_type capacity, size_type current) noexcept;
+
+        constexpr size_type capacity() const noexcept;
+
+        Pointer data;
+        size_type cap;
+        size_type current;
+    };
+
     template <typename U>
     struct basic_iterator
     {
@@ -83,8 +123,7 @@ private:
         template <typename ConstU = U,
                   typename std::enable_if<std::is_const<ConstU>::value, int>::type = 0>
         constexpr basic_iterator(const basic_iterator<typename std::remove_const<ConstU>::type>& other) noexcept
-            : parent(other.parent),
-              current(other.current)
+            : member(other.member.data, other.member.capacity(), other.member.current)
         {}
 
         TRIAL_CXX14_CONSTEXPR
@@ -114,14 +153,10 @@ private:
 
         constexpr difference_type operator-(const iterator_type&) const noexcept;
 
-        TRIAL_CXX14_CONSTEXPR
-        reference operator[](difference_type) noexcept;
+        constexpr reference operator[](difference_type) const noexcept;
 
-        TRIAL_CXX14_CONSTEXPR
-        pointer operator->() noexcept;
-        TRIAL_CXX14_CONSTEXPR
-        reference operator*() noexcept;
-        constexpr const_reference operator*() const noexcept;
+        constexpr pointer operator->() const noexcept;
+        constexpr reference operator*() const noexcept;
 
         constexpr bool operator==(const iterator_type&) const noexcept;
         constexpr bool operator!=(const iterator_type&) const noexcept;
@@ -131,17 +166,18 @@ private:
         constexpr bool operator>=(const iterator_type&) const noexcept;
 
     private:
-        friend class span<T, Extent>;
+        friend class span<T, Extent, SizeType, Policy>;
+        template <typename>
+        friend struct basic_iterator;
 
-        using span_pointer = typename std::conditional<std::is_const<U>::value,
-                                                       typename std::add_pointer<typename std::add_const<span<T, Extent>>::type>::type,
-                                                       typename std::add_pointer<span<T, Extent>>::type>::type;
+        // The iterator refers to the underlying storage rather than to the
+        // span, so iterators remain valid after the span is destroyed.
+        constexpr basic_iterator(pointer data, size_type capacity, size_type index) noexcept;
 
-        constexpr basic_iterator(span_pointer parent, const size_type index) noexcept;
+        constexpr size_type vindex(size_type) const noexcept;
 
     private:
-        span_pointer parent;
-        size_type current;
+        iterator_storage<pointer, Extent> member;
     };
 
 public:
@@ -158,9 +194,17 @@ public:
     //!
     //! Unspecified type that models the ContiguousRange and SizedRange requirements.
 
-    using segment = circular::detail::segment<value_type>;
+    using segment = circular::detail::segment<element_type>;
     using const_segment = circular::detail::segment<const value_type>;
 
+    //! @brief Range of contiguous segments.
+    //!
+    //! Unspecified type that models the RandomAccessRange and SizedRange
+    //! requirements with segment as value type.
+
+    using segment_range = circular::detail::segment_range<segment>;
+    using const_segment_range = circular::detail::segment_range<const_segment>;
+
     //! @brief Creates empty circular span.
     //!
     //! No elements can be inserted into a zero capacity span. The span must
@@ -183,8 +227,9 @@ public:
 
     template <typename OtherT,
               std::size_t OtherExtent,
+              typename OtherPolicy,
               typename std::enable_if<(Extent == OtherExtent || Extent == dynamic_extent) && std::is_convertible<OtherT (*)[], T (*)[]>::value, int>::type = 0>
-    explicit constexpr span(const span<OtherT, OtherExtent>& other) noexcept;
+    explicit constexpr span(const span<OtherT, OtherExtent, SizeType, OtherPolicy>& other) noexcept;
 
     //! @brief Creates circular span by moving.
     //!
@@ -331,15 +376,22 @@ public:
 
     //! @brief Inserts element at beginning of span.
     //!
-    //! If span is full, then the element at the end of the span is silently erased
-    //! to make room for the @c input value.
+    //! If span is full, then the element at the end of the span is erased
+    //! to make room for the @c input value. The erased element is passed to
+    //! the on_evict() hook of the policy before it is overwritten.
+    //!
+    //! If span is full and the overflow policy is reject, then the @c input
+    //! value is discarded instead.
     //!
     //! @pre capacity() > 0
 
     TRIAL_CXX14_CONSTEXPR
     void push_front(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
 
-    //! @brief Inserts element at beginning of span.
+    //! @brief Inserts elements at beginning of span.
+    //!
+    //! Forward iterator ranges are inserted in bulk, so erased elements are
+    //! passed to the on_evict() hook of the policy as whole segments.
     //!
     //! @pre capacity() > 0
 
@@ -349,8 +401,12 @@ public:
 
     //! @brief Inserts element at end of span.
     //!
-    //! If span is full, then the element at the end of the span is silently erased
-    //! to make room for the @c input value.
+    //! If span is full, then the element at the beginning of the span is erased
+    //! to make room for the @c input value. The erased element is passed to
+    //! the on_evict() hook of the policy before it is overwritten.
+    //!
+    //! If span is full and the overflow policy is reject, then the @c input
+    //! value is discarded instead.
     //!
     //! @pre capacity() > 0
 
@@ -359,12 +415,89 @@ public:
 
     //! @brief Inserts elements at end of span.
     //!
+    //! Forward iterator ranges are inserted in bulk, so erased elements are
+    //! passed to the on_evict() hook of the policy as whole segments.
+    //!
     //! @pre capacity() > 0
 
     template <typename InputIterator>
     TRIAL_CXX14_CONSTEXPR
     void push_back(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
 
+    //! @brief Inserts element at beginning of span unless full.
+    //!
+    //! Never overwrites elements regardless of the overflow policy.
+    //!
+    //! @returns true if element was inserted, false otherwise.
+
+    TRIAL_CXX14_CONSTEXPR
+    bool try_push_front(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Inserts elements at beginning of span until full.
+    //!
+    //! Never overwrites elements regardless of the overflow policy.
+    //!
+    //! @returns Number of inserted elements.
+
+    template <typename InputIterator>
+    TRIAL_CXX14_CONSTEXPR
+    size_type try_push_front(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+
+    //! @brief Inserts element at end of span unless full.
+    //!
+    //! Never overwrites elements regardless of the overflow policy.
+    //!
+    //! @returns true if element was inserted, false otherwise.
+
+    TRIAL_CXX14_CONSTEXPR
+    bool try_push_back(value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Inserts elements at end of span until full.
+    //!
+    //! Never overwrites elements regardless of the overflow policy.
+    //!
+    //! @returns Number of inserted elements.
+
+    template <typename InputIterator>
+    TRIAL_CXX14_CONSTEXPR
+    size_type try_push_back(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+
+    //! @brief Inserts element before position.
+    //!
+    //! The elements on the shorter side of the position are moved one step
+    //! away from the position to make room for the @c input value, so at most
+    //! size() / 2 elements are moved.
+    //!
+    //! Insertion invalidates iterators.
+    //!
+    //! @pre !full()
+    //! @returns Iterator to the inserted element.
+
+    iterator insert(const_iterator position, value_type input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Removes element at position.
+    //!
+    //! @pre position != end()
+    //! @returns Iterator to the element after the removed element.
+    //!
+    //! @sa erase(const_iterator, const_iterator)
+
+    iterator erase(const_iterator position) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
+    //! @brief Removes elements in range.
+    //!
+    //! The elements on the shorter side of the range are moved towards the
+    //! range to close the gap, so at most size() / 2 elements are moved.
+    //! Trivially copyable elements are moved segment by segment with
+    //! std::memmove.
+    //!
+    //! The removed elements in the underlying storage are left in a
+    //! moved-from state. Erasure invalidates iterators.
+    //!
+    //! @returns Iterator to the element after the removed elements.
+
+    iterator erase(const_iterator first, const_iterator last) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
     //! @brief Removes and returns element from beginning of span.
     //!
     //! @pre !empty()
@@ -388,23 +521,31 @@ public:
     //! initialized values.
     //!
     //! If the span is full, then the elements at the front are taken from the
-    //! back.
+    //! back. If the overflow policy is reject, then only the unused elements
+    //! are inserted instead.
+    //!
+    //! Returns the number of inserted elements.
     //!
     //! @pre capacity() > 0
     //! @pre count <= capacity()
+    //! @pre count <= capacity() - size() if overflow policy is assertion
 
     TRIAL_CXX14_CONSTEXPR
-    void expand_front(size_type count = 1U) noexcept;
+    size_type expand_front(size_type count = 1U) noexcept;
 
     //! @brief Inserts unspecified elements at the end of the span.
     //!
+    //! Returns the number of inserted elements, which is less than @c count
+    //! if the overflow policy is reject and there are too few unused elements.
+    //!
     //! @pre capacity() > 0
     //! @pre count <= capacity()
+    //! @pre count <= capacity() - size() if overflow policy is assertion
     //!
-    //! @sa increment_front
+    //! @sa expand_front
 
     TRIAL_CXX14_CONSTEXPR
-    void expand_back(size_type count = 1U) noexcept;
+    size_type expand_back(size_type count = 1U) noexcept;
 
     //! @brief Removes elements from beginning of span.
     //!
@@ -568,6 +709,38 @@ public:
     segment last_unused_segment() noexcept;
     constexpr const_segment last_unused_segment() const noexcept;
 
+    //! @brief Returns the contiguous segments of the span.
+    //!
+    //! The range contains the non-empty segments among first_segment() and
+    //! last_segment() in that order, so it holds at most two segments.
+    //!
+    //! Iterating over the segments visits the same elements in the same order
+    //! as iterating over the span, but with contiguous inner loops.
+    //!
+    //! @pre capacity() > 0
+
+    TRIAL_CXX14_CONSTEXPR
+    segment_range segments() noexcept;
+    constexpr const_segment_range segments() const noexcept;
+
+    //! @brief Returns statistics of the policy.
+    //!
+    //! Only available if the policy has statistics, such as policy::statistics.
+
+    template <typename U = Policy>
+    constexpr auto stats() const noexcept -> decltype(std::declval<const U&>().stats());
+
+    //! @brief Returns the policy.
+    //!
+    //! Can be used to configure the state of a custom policy.
+
+    TRIAL_CXX14_CONSTEXPR
+    Policy& get_policy() noexcept;
+
+    //! @brief Returns the policy.
+
+    constexpr const Policy& get_policy() const noexcept;
+
 protected:
     //! @brief Creates circular span by copying.
     //!
@@ -582,6 +755,15 @@ protected:
     TRIAL_CXX14_CONSTEXPR
     void assign(const span&, pointer) noexcept;
 
+    //! @brief Recreates circular span from iterators without changing policy.
+
+    template <typename ContiguousIterator>
+    TRIAL_CXX14_CONSTEXPR
+    void rebind(ContiguousIterator begin,
+                ContiguousIterator end,
+                ContiguousIterator first,
+                size_type length) noexcept;
+
 private:
     constexpr size_type index(size_type) const noexcept;
     constexpr size_type vindex(size_type) const noexcept;
@@ -594,6 +776,28 @@ private:
     constexpr const_reference at(size_type) const noexcept;
 
     constexpr bool wraparound() const noexcept;
+
+    TRIAL_CXX14_CONSTEXPR
+    void evict(size_type position, size_type count) noexcept;
+
+    void move_range(size_type target, size_type source, size_type count) noexcept(std::is_nothrow_move_assignable<value_type>::value);
+
+    template <typename InputIterator>
+    TRIAL_CXX14_CONSTEXPR
+    void push_front_range(InputIterator first, InputIterator last, std::input_iterator_tag) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+
+    template <typename ForwardIterator>
+    TRIAL_CXX14_CONSTEXPR
+    void push_front_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+
+    template <typename InputIterator>
+    TRIAL_CXX14_CONSTEXPR
+    void push_back_range(InputIterator first, InputIterator last, std::input_iterator_tag) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+
+    template <typename ForwardIterator>
+    TRIAL_CXX14_CONSTEXPR
+    void push_back_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
+
     constexpr bool unused_wraparound() const noexcept;
 
     TRIAL_CXX14_CONSTEXPR
@@ -618,8 +822,8 @@ private:
 
         constexpr member_storage(const member_storage&, pointer data) noexcept;
 
-        template <typename OtherT, std::size_t OtherExtent>
-        explicit constexpr member_storage(const span<OtherT, OtherExtent>&) noexcept;
+        template <typename OtherT, std::size_t OtherExtent, typename OtherPolicy>
+        explicit constexpr member_storage(const span<OtherT, OtherExtent, SizeType, OtherPolicy>&) noexcept;
 
         template <typename ContiguousIterator>
         TRIAL_CXX14_CONSTEXPR
@@ -660,8 +864,8 @@ private:
 
         constexpr member_storage(const member_storage&, pointer data) noexcept;
 
-        template <typename OtherT, std::size_t OtherExtent>
-        explicit constexpr member_storage(const span<OtherT, OtherExtent>&) noexcept;
+        template <typename OtherT, std::size_t OtherExtent, typename OtherPolicy>
+        explicit constexpr member_storage(const span<OtherT, OtherExtent, SizeType, OtherPolicy>&) noexcept;
 
         template <typename ContiguousIterator>
         constexpr member_storage(ContiguousIterator, ContiguousIterator) noexcept;
@@ -694,4 +898,22 @@ private:
 
 #include <trial/circular/detail/span.ipp>
 
+#if TRIAL_CIRCULAR_RANGES
+
+namespace std
+{
+namespace ranges
+{
+
+// Iterators refer to the underlying storage rather than to the span, so they
+// remain valid after the span is destroyed.
+
+template <typename T, std::size_t Extent, typename SizeType, typename Policy>
+inline constexpr bool enable_borrowed_range<trial::circular::span<T, Extent, SizeType, Policy>> = true;
+
+} // namespace ranges
+} // namespace std
+
+#endif
+
 #endif // TRIAL_CIRCULAR_SPAN_HPP
@@ -0,0 +1,155 @@
+#ifndef TRIAL_CIRCULAR_STATISTICS_HPP
+#define TRIAL_CIRCULAR_STATISTICS_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <type_traits>
+#include <trial/circular/detail/window.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+//! @brief Moving statistics over the most recent values.
+//!
+//! Keeps the sum, mean, and variance of a window of the most recent values.
+//! The window is a circular array when N is given, or a circular vector when N
+//! is dynamic_extent.
+//!
+//! The sum is updated with compensated summation (error-free TwoSum) and
+//! the variance with Welford's algorithm extended to remove the value leaving
+//! the window, so insertion has constant time complexity.
+//!
+//! The accumulated rounding errors are bounded by recalculating the statistics
+//! exactly over the segments of the window whenever the window has been
+//! completely replaced, which amortizes to constant time per insertion.
+
+template <typename T, std::size_t N = dynamic_extent>
+class statistics
+{
+    static_assert(std::is_floating_point<T>::value, "T must be a floating-point type");
+
+    using window_type = detail::window<T, N>;
+
+public:
+    using value_type = typename window_type::value_type;
+    using size_type = typename window_type::size_type;
+    using const_iterator = typename window_type::const_iterator;
+
+    //! @brief Creates empty moving statistics with fixed capacity N.
+    //!
+    //! @post capacity() == N
+
+    template <std::size_t M = N,
+              typename std::enable_if<M != dynamic_extent, int>::type = 0>
+    statistics() noexcept;
+
+    //! @brief Creates empty moving statistics with capacity.
+    //!
+    //! @pre capacity > 0
+    //! @post capacity() == capacity
+
+    template <std::size_t M = N,
+              typename std::enable_if<M == dynamic_extent, int>::type = 0>
+    explicit statistics(size_type capacity);
+
+    //! @brief Checks if window is empty.
+
+    bool empty() const noexcept;
+
+    //! @brief Checks if window is full.
+
+    bool full() const noexcept;
+
+    //! @brief Returns the number of values in window.
+
+    size_type size() const noexcept;
+
+    //! @brief Returns the maximum number of values in window.
+
+    size_type capacity() const noexcept;
+
+    //! @brief Clears the window.
+
+    void clear() noexcept;
+
+    //! @brief Appends value.
+    //!
+    //! If the window is full, then the oldest value is evicted.
+    //!
+    //! Amortized constant time complexity.
+
+    void push(value_type input) noexcept;
+
+    //! @brief Returns the sum of the values in window.
+
+    value_type sum() const noexcept;
+
+    //! @brief Returns the mean of the values in window.
+    //!
+    //! @pre !empty()
+
+    value_type mean() const noexcept;
+
+    //! @brief Returns the biased (population) variance of the values in window.
+    //!
+    //! @pre !empty()
+
+    value_type variance() const noexcept;
+
+    //! @brief Returns the unbiased (sample) variance of the values in window.
+    //!
+    //! @pre size() > 1
+
+    value_type unbiased_variance() const noexcept;
+
+    //! @brief Returns the biased standard deviation of the values in window.
+    //!
+    //! @pre !empty()
+
+    value_type standard_deviation() const noexcept;
+
+    //! @brief Recalculates statistics exactly from the values in window.
+    //!
+    //! Linear time complexity.
+
+    void recalculate() noexcept;
+
+    //! @brief Returns iterator to the oldest value in the window.
+
+    const_iterator begin() const noexcept;
+
+    //! @brief Returns iterator to the ending of the window.
+
+    const_iterator end() const noexcept;
+
+private:
+    void add(value_type) noexcept;
+
+private:
+    window_type window;
+    struct
+    {
+        value_type sum = value_type(0);
+        value_type compensation = value_type(0);
+        // Sum of squared deviations from the mean
+        value_type squares = value_type(0);
+        size_type evictions = 0;
+    } member;
+};
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/statistics.ipp>
+
+#endif // TRIAL_CIRCULAR_STATISTICS_HPP
@@ -0,0 +1,157 @@
+#ifndef TRIAL_CIRCULAR_TIMED_RING_HPP
+#define TRIAL_CIRCULAR_TIMED_RING_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <trial/circular/vector.hpp>
+
+namespace trial
+{
+namespace circular
+{
+
+//! @brief Circular buffer with time-based eviction.
+//!
+//! Values are stored together with their timestamps. The timestamps and values
+//! are kept in two separate circular vectors that are modified in lockstep, so
+//! searching the timestamps does not touch the values.
+//!
+//! Timestamps must be appended in non-decreasing order. Values older than a
+//! given time are evicted by expire(), which finds the first value to keep by
+//! binary search over the timestamps.
+//!
+//! When the buffer is full, the oldest value is evicted on insertion as with
+//! other circular containers.
+
+template <typename T, typename Clock = std::chrono::steady_clock>
+class timed_ring
+{
+public:
+    using clock = Clock;
+    using time_point = typename clock::time_point;
+    using duration = typename clock::duration;
+    using value_container = circular::vector<T>;
+    using timestamp_container = circular::vector<time_point>;
+    using value_type = typename value_container::value_type;
+    using size_type = typename value_container::size_type;
+    using reference = typename value_container::reference;
+    using const_reference = typename value_container::const_reference;
+    using iterator = typename value_container::iterator;
+    using const_iterator = typename value_container::const_iterator;
+
+    //! @brief Creates empty timed ring with capacity.
+    //!
+    //! @pre capacity > 0
+    //! @post capacity() == capacity
+
+    explicit timed_ring(size_type capacity);
+
+    //! @brief Checks if ring is empty.
+
+    bool empty() const noexcept;
+
+    //! @brief Checks if ring is full.
+
+    bool full() const noexcept;
+
+    //! @brief Returns the number of values in ring.
+
+    size_type size() const noexcept;
+
+    //! @brief Returns the maximum number of values in ring.
+
+    size_type capacity() const noexcept;
+
+    //! @brief Clears the ring.
+
+    void clear() noexcept;
+
+    //! @brief Appends value with timestamp.
+    //!
+    //! If the ring is full, then the oldest value is evicted.
+    //!
+    //! Constant time complexity.
+    //!
+    //! @pre empty() || when >= timestamps().back()
+
+    void push(time_point when, value_type input);
+
+    //! @brief Appends value with current time as timestamp.
+
+    void push(value_type input);
+
+    //! @brief Removes values with timestamps before cutoff.
+    //!
+    //! Logarithmic time complexity.
+    //!
+    //! @returns Number of removed values.
+
+    size_type expire(time_point cutoff) noexcept;
+
+    //! @brief Returns reference to the oldest value.
+    //!
+    //! @pre !empty()
+
+    reference front() noexcept;
+    const_reference front() const noexcept;
+
+    //! @brief Returns reference to the newest value.
+    //!
+    //! @pre !empty()
+
+    reference back() noexcept;
+    const_reference back() const noexcept;
+
+    //! @brief Returns timestamp of the oldest value.
+    //!
+    //! @pre !empty()
+
+    time_point front_time() const noexcept;
+
+    //! @brief Returns timestamp of the newest value.
+    //!
+    //! @pre !empty()
+
+    time_point back_time() const noexcept;
+
+    //! @brief Returns the values.
+
+    const value_container& values() const noexcept;
+
+    //! @brief Returns the timestamps.
+
+    const timestamp_container& timestamps() const noexcept;
+
+    //! @brief Returns iterator to the oldest value.
+
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+
+    //! @brief Returns iterator to the ending.
+
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+
+private:
+    struct
+    {
+        timestamp_container timestamps;
+        value_container values;
+    } member;
+};
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/timed_ring.ipp>
+
+#endif // TRIAL_CIRCULAR_TIMED_RING_HPP
@@ -28,15 +28,20 @@ namespace circular
 //! overwriting old elements. Capacity can only be changed by explicit calls
 //! to @c reserve() or @c resize().
 //!
+//! Policy provides hooks that are called when elements are inserted or
+//! removed.
+//!
 //! Violation of any precondition results in undefined behavior.
 
-template <typename T, typename Allocator = typename std::vector<T>::allocator_type>
+template <typename T,
+          typename Allocator = typename std::vector<T>::allocator_type,
+          typename Policy = policy::basic>
 class vector
     : private std::vector<T, Allocator>,
-      private circular::span<T>
+      private circular::span<T, dynamic_extent, std::size_t, Policy>
 {
     using storage = std::vector<T, Allocator>;
-    using span = circular::template span<T>;
+    using span = circular::template span<T, dynamic_extent, std::size_t, Policy>;
 
 public:
     using element_type = typename span::element_type;
@@ -48,6 +53,10 @@ public:
     using const_iterator = typename span::const_iterator;
     using reverse_iterator = typename span::reverse_iterator;
     using const_reverse_iterator = typename span::const_reverse_iterator;
+    using segment = typename span::segment;
+    using const_segment = typename span::const_segment;
+    using segment_range = typename span::segment_range;
+    using const_segment_range = typename span::const_segment_range;
     using allocator_type = Allocator;
 
     //! @brief Creates an empty circular vector with no capacity.
@@ -55,6 +64,7 @@ public:
     //! @post capacity() == 0
     //! @post size() == 0
 
+    TRIAL_CXX20_CONSTEXPR
     vector() noexcept(std::is_nothrow_default_constructible<storage>::value);
 
     //! @brief Creates empty circular vector with no capacity using allocator.
@@ -62,6 +72,7 @@ public:
     //! @post capacity() == 0
     //! @post size() == 0
 
+    TRIAL_CXX20_CONSTEXPR
     explicit vector(const allocator_type&) noexcept(std::is_nothrow_constructible<storage, const allocator_type&>::value);
 
     //! @brief Creates circular vector by copy construction.
@@ -69,6 +80,7 @@ public:
     //! @post capacity() == other.capacity()
     //! @post size() == other.size()
 
+    TRIAL_CXX20_CONSTEXPR
     vector(const vector& other);
 
     //! @brief Creates circular vector by copy construction with allocator.
@@ -76,6 +88,7 @@ public:
     //! @post capacity() == other.capacity()
     //! @post size() == other.size()
 
+    TRIAL_CXX20_CONSTEXPR
     vector(const vector&,
            const allocator_type&);
 
@@ -84,6 +97,7 @@ public:
     //! @post capacity() == other.capacity()
     //! @post size() == other.size()
 
+    TRIAL_CXX20_CONSTEXPR
     vector(vector&& other) noexcept(std::is_nothrow_move_constructible<storage>::value) = default;
 
     //! @brief Creates circular vector by move construction with allocator.
@@ -91,6 +105,7 @@ public:
     //! @post capacity() == other.capacity()
     //! @post size() == other.size()
 
+    TRIAL_CXX20_CONSTEXPR
     vector(vector&& other,
            const allocator_type&) noexcept(std::is_nothrow_constructible<storage, storage&&, const allocator_type&>::value);
 
@@ -99,6 +114,7 @@ public:
     //! @post capacity() == other.capacity()
     //! @post size() == other.size()
 
+    TRIAL_CXX20_CONSTEXPR
     vector& operator=(const vector& other);
 
     //! @brief Recreates circular vector by move assignment.
@@ -106,6 +122,7 @@ public:
     //! @post capacity() == other.capacity()
     //! @post size() == other.size()
 
+    TRIAL_CXX20_CONSTEXPR
     vector& operator=(vector&& other) noexcept(std::is_nothrow_move_assignable<storage>::value) = default;
 
     //! @brief Creates empty circular vector with capacity.
@@ -115,6 +132,7 @@ public:
     //! @post capacity() == capacity
     //! @post size() == 0
 
+    TRIAL_CXX20_CONSTEXPR
     explicit vector(size_type capacity);
 
     //! @brief Creates empty circular vector with capacity using allocator.
@@ -124,6 +142,7 @@ public:
     //! @post capacity() == capacity
     //! @post size() == 0
 
+    TRIAL_CXX20_CONSTEXPR
     vector(size_type capacity,
            const allocator_type&);
 
@@ -132,6 +151,7 @@ public:
     //! @post capacity() == input.size()
     //! @post size() == input.size()
 
+    TRIAL_CXX20_CONSTEXPR
     vector(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
 
     //! @brief Creates circular vector with element from initializer list with allocator.
@@ -139,6 +159,7 @@ public:
     //! @post capacity() == input.size()
     //! @post size() == input.size()
 
+    TRIAL_CXX20_CONSTEXPR
     vector(std::initializer_list<value_type> input,
            const allocator_type&) noexcept(std::is_nothrow_move_assignable<value_type>::value);
 
@@ -147,6 +168,7 @@ public:
     //! @post capacity() == input.size()
     //! @post size() == input.size()
 
+    TRIAL_CXX20_CONSTEXPR
     vector& operator=(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<value_type>::value);
 
     //! @brief Creates circular vector with elements from range.
@@ -155,6 +177,7 @@ public:
     //! @post size() == capacity()
 
     template <typename InputIterator>
+    TRIAL_CXX20_CONSTEXPR
     vector(InputIterator first,
            InputIterator last) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
 
@@ -164,12 +187,14 @@ public:
     //! @post size() == capacity()
 
     template <typename InputIterator>
+    TRIAL_CXX20_CONSTEXPR
     vector(InputIterator first,
            InputIterator last,
            const allocator_type&) noexcept(std::is_nothrow_copy_assignable<value_type>::value);
 
     //! @brief Returns underlying allocator.
 
+    TRIAL_CXX20_CONSTEXPR
     allocator_type get_allocator() const;
 
     //! @brief Checks if circular vector is empty.
@@ -195,6 +220,7 @@ public:
     //! @post capacity() == std::max(capacity, capacity())
     //! @post is_normalized()
 
+    TRIAL_CXX20_CONSTEXPR
     void reserve(size_type capacity);
 
     //! @brief Returns the number of elements in circular vector.
@@ -207,6 +233,7 @@ public:
 
     //! @brief Increases the number of elements by default construction.
 
+    TRIAL_CXX20_CONSTEXPR
     void resize(size_type count);
 
     //! @brief Increases the number of elements by copy construction.
@@ -222,6 +249,7 @@ public:
     //! @post size() == count
     //! @post is_normalized()
 
+    TRIAL_CXX20_CONSTEXPR
     void resize(size_type count, const value_type& input);
 
     //! @brief Removes excess capacity.
@@ -253,12 +281,48 @@ public:
     //! Time complexity is amortized constant when there is spare capacity,
     //! otherwise it is linear.
 
+    TRIAL_CXX20_CONSTEXPR
     void push_front(value_type);
 
     //! @brief Inserts element at end of circular vector.
 
+    TRIAL_CXX20_CONSTEXPR
     void push_back(value_type);
 
+    //! @brief Inserts element at beginning of circular vector unless full.
+    //!
+    //! Spare capacity is used before the circular vector is considered full.
+    //!
+    //! @returns true if element was inserted, false otherwise.
+
+    TRIAL_CXX20_CONSTEXPR
+    bool try_push_front(value_type);
+
+    //! @brief Inserts element at end of circular vector unless full.
+    //!
+    //! Spare capacity is used before the circular vector is considered full.
+    //!
+    //! @returns true if element was inserted, false otherwise.
+
+    TRIAL_CXX20_CONSTEXPR
+    bool try_push_back(value_type);
+
+    //! @brief Inserts element before position.
+    //!
+    //! Spare capacity is used if the circular vector is full. Otherwise the
+    //! elements on the shorter side of the position are moved.
+    //!
+    //! @pre !full() || capacity() < storage capacity
+    //! @returns Iterator to the inserted element.
+
+    iterator insert(const_iterator position, value_type input);
+
+    //! @brief Removes elements.
+    //!
+    //! The elements on the shorter side of the removed elements are moved.
+
+    using span::erase;
+
     //! @brief Removes and returns element from beginning of circular vector.
 
     using span::pop_front;
@@ -314,6 +378,34 @@ public:
     //! @brief Returns const reverse iterator to ending of circular array.
 
     using span::crend;
+
+    //! @brief Returns first contiguous segment of circular vector.
+
+    using span::first_segment;
+
+    //! @brief Returns last contiguous segment of circular vector.
+
+    using span::last_segment;
+
+    //! @brief Returns first contiguous unused segment of circular vector.
+
+    using span::first_unused_segment;
+
+    //! @brief Returns last contiguous unused segment of circular vector.
+
+    using span::last_unused_segment;
+
+    //! @brief Returns contiguous segments of circular vector.
+
+    using span::segments;
+
+    //! @brief Returns statistics of the policy.
+
+    using span::stats;
+
+    //! @brief Returns the policy.
+
+    using span::get_policy;
 };
 
 } // namespace circular
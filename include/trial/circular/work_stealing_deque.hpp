@@ -0,0 +1,134 @@
+#ifndef TRIAL_CIRCULAR_WORK_STEALING_DEQUE_HPP
+#define TRIAL_CIRCULAR_WORK_STEALING_DEQUE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <type_traits>
+
+namespace trial
+{
+namespace circular
+{
+
+//! @brief Lock-free work-stealing deque.
+//!
+//! Chase-Lev deque where a single owner thread inserts and removes elements
+//! at the back, and any number of thief threads remove elements at the front.
+//!
+//! The owner operations are wait-free except when the storage grows. The
+//! thief operation takes the front element with compare-and-swap, and fails
+//! if another thief or the owner takes the element first.
+//!
+//! Elements are stored in a circular buffer whose capacity is a power of two.
+//! When the buffer is full, push_back() copies the elements into a buffer of
+//! twice the capacity. The old buffer is kept alive until the deque is
+//! destroyed because thieves may still be reading from it.
+//!
+//! @tparam T Element type, which must be trivially copyable.
+
+template <typename T>
+class work_stealing_deque
+{
+    static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    //! @brief Creates empty deque with capacity.
+    //!
+    //! The capacity is rounded up to the nearest power of two.
+    //!
+    //! @pre capacity > 0
+
+    explicit work_stealing_deque(size_type capacity = 64);
+
+    work_stealing_deque(const work_stealing_deque&) = delete;
+    work_stealing_deque(work_stealing_deque&&) = delete;
+    work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+    work_stealing_deque& operator=(work_stealing_deque&&) = delete;
+
+    ~work_stealing_deque();
+
+    //! @brief Checks if deque is empty.
+    //!
+    //! The result may be stale when called concurrently with other operations.
+
+    bool empty() const noexcept;
+
+    //! @brief Returns the number of elements in deque.
+    //!
+    //! The result may be stale when called concurrently with other operations.
+
+    size_type size() const noexcept;
+
+    //! @brief Returns the number of elements that can be held before growing.
+    //!
+    //! Must only be called by the owner.
+
+    size_type capacity() const noexcept;
+
+    //! @brief Inserts element at the back.
+    //!
+    //! Grows the storage if the deque is full.
+    //!
+    //! Must only be called by the owner.
+    //!
+    //! Amortized constant time complexity.
+
+    void push_back(value_type input);
+
+    //! @brief Removes element at the back.
+    //!
+    //! Must only be called by the owner.
+    //!
+    //! @returns true if an element was removed into output, false if empty.
+
+    bool try_pop_back(value_type& output) noexcept;
+
+    //! @brief Removes element at the front.
+    //!
+    //! May be called by any thread.
+    //!
+    //! @returns true if an element was removed into output, false if empty or
+    //!          if the element was taken by another thread.
+
+    bool try_steal_front(value_type& output) noexcept;
+
+private:
+    using index_type = std::ptrdiff_t;
+
+    class storage;
+
+    storage* grow(storage*, index_type front, index_type back);
+
+    struct
+    {
+        std::atomic<index_type> front;
+        // Keep front and back on separate cache lines to avoid false sharing
+        // between thieves and owner.
+        char padding[64 - sizeof(std::atomic<index_type>)];
+        std::atomic<index_type> back;
+        std::atomic<storage *> buffer;
+        std::vector<std::unique_ptr<storage>> buffers;
+    } member;
+};
+
+} // namespace circular
+} // namespace trial
+
+#include <trial/circular/detail/work_stealing_deque.ipp>
+
+#endif // TRIAL_CIRCULAR_WORK_STEALING_DEQUE_HPP
@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <functional>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/array.hpp>
+#include <trial/circular/vector.hpp>
+#include <trial/circular/algorithm.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace lower_bound_suite
+{
+
+void lower_bound_empty()
+{
+    circular::array<int, 4> data;
+    TRIAL_TEST(circular::lower_bound(data, 1) == data.end());
+}
+
+void lower_bound_contiguous()
+{
+    circular::array<int, 4> data = { 11, 22, 33 };
+    TRIAL_TEST(circular::lower_bound(data, 0) == data.begin());
+    TRIAL_TEST(circular::lower_bound(data, 11) == data.begin());
+    TRIAL_TEST(circular::lower_bound(data, 12) == data.begin() + 1);
+    TRIAL_TEST(circular::lower_bound(data, 33) == data.begin() + 2);
+    TRIAL_TEST(circular::lower_bound(data, 34) == data.end());
+}
+
+void lower_bound_wraparound()
+{
+    circular::array<int, 4> data = { 11, 22, 33, 44 };
+    data.push_back(55);
+    data.push_back(66);
+    TRIAL_TEST_EQ(data.last_segment().size(), 2);
+    TRIAL_TEST(circular::lower_bound(data, 0) == data.begin());
+    TRIAL_TEST(circular::lower_bound(data, 33) == data.begin());
+    TRIAL_TEST(circular::lower_bound(data, 44) == data.begin() + 1);
+    TRIAL_TEST(circular::lower_bound(data, 45) == data.begin() + 2);
+    TRIAL_TEST(circular::lower_bound(data, 55) == data.begin() + 2);
+    TRIAL_TEST(circular::lower_bound(data, 66) == data.begin() + 3);
+    TRIAL_TEST(circular::lower_bound(data, 67) == data.end());
+}
+
+void lower_bound_const()
+{
+    circular::array<int, 4> data = { 11, 22, 33, 44 };
+    data.push_back(55);
+    const auto& cdata = data;
+    TRIAL_TEST(circular::lower_bound(cdata, 44) == cdata.begin() + 2);
+}
+
+void lower_bound_compare()
+{
+    circular::array<int, 4> data = { 44, 33, 22, 11 };
+    data.push_back(0);
+    TRIAL_TEST(circular::lower_bound(data, 22, std::greater<int>()) == data.begin() + 1);
+    TRIAL_TEST(circular::lower_bound(data, 0, std::greater<int>()) == data.begin() + 3);
+}
+
+void lower_bound_exhaustive()
+{
+    // Compare with std::lower_bound at every rotation
+    for (int rotation = 0; rotation < 8; ++rotation)
+    {
+        circular::vector<int> data(5);
+        for (int k = 0; k < 5 + rotation; ++k)
+        {
+            data.push_back(2 * k);
+        }
+        for (int value = -1; value < 2 * (6 + rotation); ++value)
+        {
+            TRIAL_TEST(circular::lower_bound(data, value) == std::lower_bound(data.begin(), data.end(), value));
+            TRIAL_TEST(circular::upper_bound(data, value) == std::upper_bound(data.begin(), data.end(), value));
+        }
+    }
+}
+
+void run()
+{
+    lower_bound_empty();
+    lower_bound_contiguous();
+    lower_bound_wraparound();
+    lower_bound_const();
+    lower_bound_compare();
+    lower_bound_exhaustive();
+}
+
+} // namespace lower_bound_suite
+
+//-----------------------------------------------------------------------------
+
+namespace upper_bound_suite
+{
+
+void upper_bound_empty()
+{
+    circular::array<int, 4> data;
+    TRIAL_TEST(circular::upper_bound(data, 1) == data.end());
+}
+
+void upper_bound_wraparound()
+{
+    circular::array<int, 4> data = { 11, 22, 33, 44 };
+    data.push_back(55);
+    data.push_back(66);
+    TRIAL_TEST(circular::upper_bound(data, 0) == data.begin());
+    TRIAL_TEST(circular::upper_bound(data, 33) == data.begin() + 1);
+    TRIAL_TEST(circular::upper_bound(data, 44) == data.begin() + 2);
+    TRIAL_TEST(circular::upper_bound(data, 54) == data.begin() + 2);
+    TRIAL_TEST(circular::upper_bound(data, 55) == data.begin() + 3);
+    TRIAL_TEST(circular::upper_bound(data, 66) == data.end());
+}
+
+void run()
+{
+    upper_bound_empty();
+    upper_bound_wraparound();
+}
+
+} // namespace upper_bound_suite
+
+//-----------------------------------------------------------------------------
+
+namespace equal_range_suite
+{
+
+void equal_range_wraparound()
+{
+    circular::array<int, 4> data = { 11, 22, 22, 33 };
+    data.push_back(33);
+    data.push_back(44);
+    // 22, 33, 33, 44
+    auto range = circular::equal_range(data, 33);
+    TRIAL_TEST(range.first == data.begin() + 1);
+    TRIAL_TEST(range.second == data.begin() + 3);
+    range = circular::equal_range(data, 30);
+    TRIAL_TEST(range.first == range.second);
+}
+
+void run()
+{
+    equal_range_wraparound();
+}
+
+} // namespace equal_range_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    lower_bound_suite::run();
+    upper_bound_suite::run();
+    equal_range_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/array.hpp>
+#include <trial/circular/inline_array.hpp>
+#include <trial/circular/algorithm.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+constexpr circular::array<int, 4> make_array()
+{
+    circular::array<int, 4> result;
+    for (int k = 1; k <= 6; ++k)
+    {
+        result.push_back(k);
+    }
+    return result;
+}
+
+constexpr int push_back()
+{
+    auto data = make_array();
+    return 1000 * data.size() + 100 * data.front() + 10 * data[1] + data.back();
+}
+
+void api_push_back()
+{
+    static_assert(push_back() == 4346, "");
+}
+
+void api_construct()
+{
+    // The array refers to its own storage, so constant variables must be
+    // constructed in place.
+    static constexpr circular::array<int, 4> data(1, 2, 3);
+    static_assert(data.size() == 3, "");
+    static_assert(data.front() == 1, "");
+    static_assert(data.back() == 3, "");
+    TRIAL_TEST_EQ(data[1], 2);
+}
+
+constexpr int iterate()
+{
+    auto data = make_array();
+    int result = 0;
+    for (auto value : data)
+    {
+        result = 10 * result + value;
+    }
+    return result;
+}
+
+void api_iterate()
+{
+    static_assert(iterate() == 3456, "");
+}
+
+constexpr int pop()
+{
+    circular::array<int, 4> data = { 1, 2, 3 };
+    data.push_front(0);
+    const int front = data.pop_front();
+    const int back = data.pop_back();
+    return 10 * front + back;
+}
+
+void api_pop()
+{
+    static_assert(pop() == 3, "");
+}
+
+constexpr int rotate()
+{
+    auto data = make_array();
+    data.rotate_front();
+    return 10 * data.first_segment().size() + data.front();
+}
+
+void api_rotate()
+{
+    static_assert(rotate() == 43, "");
+}
+
+constexpr int copy()
+{
+    auto data = make_array();
+    circular::array<int, 4> other;
+    other = data;
+    circular::array<int, 4> moved(std::move(other));
+    moved.push_back(7);
+    return 10 * data.back() + moved.back();
+}
+
+void api_copy()
+{
+    static_assert(copy() == 67, "");
+}
+
+void run()
+{
+    api_push_back();
+    api_construct();
+    api_iterate();
+    api_pop();
+    api_rotate();
+    api_copy();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace table_suite
+{
+
+// Lookup table generated at compile-time. The inline array does not refer
+// to its own storage, so it can be returned from constexpr functions.
+
+constexpr circular::inline_array<int, 8> make_squares()
+{
+    circular::inline_array<int, 8> result;
+    for (int k = 0; k < 12; ++k)
+    {
+        result.push_back(k * k);
+    }
+    return result;
+}
+
+constexpr auto squares = make_squares();
+
+void table_squares()
+{
+    static_assert(squares.front() == 16, "");
+    static_assert(squares.back() == 121, "");
+    static_assert(squares.segments().size() == 2, "");
+    TRIAL_TEST_EQ(squares[2], 36);
+}
+
+void run()
+{
+    table_squares();
+}
+
+} // namespace table_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    table_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,268 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <thread>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/broadcast_ring.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace block_suite
+{
+
+void block_empty()
+{
+    circular::broadcast_ring<int> ring(4, 2);
+    TRIAL_TEST_EQ(ring.capacity(), 4);
+    TRIAL_TEST_EQ(ring.readers(), 2);
+    TRIAL_TEST(ring.policy() == circular::broadcast_policy::block);
+    TRIAL_TEST_EQ(ring.sequence(), 0);
+    TRIAL_TEST_EQ(ring.available(0), 0);
+    TRIAL_TEST_EQ(ring.available(1), 0);
+    TRIAL_TEST(ring.peek(0).empty());
+    int output = 0;
+    TRIAL_TEST(!ring.try_pop(0, output));
+}
+
+void block_every_reader()
+{
+    circular::broadcast_ring<int> ring(4, 2);
+    TRIAL_TEST(ring.try_push(11));
+    TRIAL_TEST(ring.try_push(22));
+    TRIAL_TEST_EQ(ring.sequence(), 2);
+    TRIAL_TEST_EQ(ring.available(0), 2);
+    TRIAL_TEST_EQ(ring.available(1), 2);
+    int output = 0;
+    TRIAL_TEST(ring.try_pop(0, output));
+    TRIAL_TEST_EQ(output, 11);
+    TRIAL_TEST(ring.try_pop(0, output));
+    TRIAL_TEST_EQ(output, 22);
+    TRIAL_TEST(!ring.try_pop(0, output));
+    TRIAL_TEST_EQ(ring.available(1), 2);
+    TRIAL_TEST(ring.try_pop(1, output));
+    TRIAL_TEST_EQ(output, 11);
+    TRIAL_TEST(ring.try_pop(1, output));
+    TRIAL_TEST_EQ(output, 22);
+    TRIAL_TEST(!ring.try_pop(1, output));
+}
+
+void block_slowest_reader()
+{
+    circular::broadcast_ring<int> ring(2, 2);
+    TRIAL_TEST(ring.try_push(11));
+    TRIAL_TEST(ring.try_push(22));
+    TRIAL_TEST(!ring.try_push(33));
+    int output = 0;
+    TRIAL_TEST(ring.try_pop(0, output));
+    TRIAL_TEST(!ring.try_push(33));
+    TRIAL_TEST(ring.try_pop(1, output));
+    TRIAL_TEST(ring.try_push(33));
+    TRIAL_TEST(!ring.try_push(44));
+    TRIAL_TEST_EQ(ring.lag(0), 0);
+    TRIAL_TEST_EQ(ring.lag(1), 0);
+}
+
+void block_segments()
+{
+    circular::broadcast_ring<int> ring(4, 1);
+    ring.push(11);
+    ring.push(22);
+    ring.push(33);
+    TRIAL_TEST(ring.consume(0, 2));
+    ring.push(44);
+    ring.push(55);
+    ring.push(66);
+    auto range = ring.peek(0);
+    TRIAL_TEST_EQ(range.size(), 2);
+    {
+        std::vector<int> expect = { 33, 44 };
+        TRIAL_TEST_ALL_EQ(range.begin()[0].begin(), range.begin()[0].end(),
+                          expect.begin(), expect.end());
+    }
+    {
+        std::vector<int> expect = { 55, 66 };
+        TRIAL_TEST_ALL_EQ(range.begin()[1].begin(), range.begin()[1].end(),
+                          expect.begin(), expect.end());
+    }
+    TRIAL_TEST(ring.consume(0, 4));
+    TRIAL_TEST(ring.peek(0).empty());
+}
+
+void run()
+{
+    block_empty();
+    block_every_reader();
+    block_slowest_reader();
+    block_segments();
+}
+
+} // namespace block_suite
+
+//-----------------------------------------------------------------------------
+
+namespace overwrite_suite
+{
+
+void overwrite_lag()
+{
+    circular::broadcast_ring<int> ring(2, 2, circular::broadcast_policy::overwrite);
+    TRIAL_TEST(ring.try_push(11));
+    TRIAL_TEST(ring.try_push(22));
+    TRIAL_TEST(ring.try_push(33));
+    TRIAL_TEST(ring.try_push(44));
+    TRIAL_TEST(ring.try_push(55));
+    TRIAL_TEST_EQ(ring.available(0), 2);
+    int output = 0;
+    TRIAL_TEST(ring.try_pop(0, output));
+    TRIAL_TEST_EQ(output, 44);
+    TRIAL_TEST_EQ(ring.lag(0), 3);
+    TRIAL_TEST(ring.try_pop(0, output));
+    TRIAL_TEST_EQ(output, 55);
+    TRIAL_TEST(!ring.try_pop(0, output));
+    TRIAL_TEST_EQ(ring.lag(0), 3);
+    TRIAL_TEST_EQ(ring.lag(1), 0);
+}
+
+void overwrite_while_reading()
+{
+    circular::broadcast_ring<int> ring(2, 1, circular::broadcast_policy::overwrite);
+    ring.push(11);
+    ring.push(22);
+    auto range = ring.peek(0);
+    TRIAL_TEST_EQ(range.size(), 1);
+    TRIAL_TEST_EQ(range.begin()->size(), 2);
+    // Writer overwrites the peeked values
+    ring.push(33);
+    TRIAL_TEST(!ring.consume(0, 2));
+    range = ring.peek(0);
+    TRIAL_TEST_EQ(ring.lag(0), 1);
+    TRIAL_TEST_EQ(range.size(), 2);
+    TRIAL_TEST_EQ(*range.begin()[0].begin(), 22);
+    TRIAL_TEST_EQ(*range.begin()[1].begin(), 33);
+    TRIAL_TEST(ring.consume(0, 2));
+}
+
+void run()
+{
+    overwrite_lag();
+    overwrite_while_reading();
+}
+
+} // namespace overwrite_suite
+
+//-----------------------------------------------------------------------------
+
+namespace concurrent_suite
+{
+
+// Every reader receives every value in order
+
+void concurrent_block()
+{
+    const int amount = 100000;
+    const int readers = 3;
+
+    circular::broadcast_ring<int> ring(64, readers);
+    std::vector<int> received(readers, 0);
+    std::vector<int> disorder(readers, 0);
+
+    std::vector<std::thread> threads;
+    for (int reader = 0; reader < readers; ++reader)
+    {
+        threads.emplace_back([&ring, &received, &disorder, reader] {
+            int expect = 0;
+            while (expect < amount)
+            {
+                auto range = ring.peek(reader);
+                std::size_t count = 0;
+                for (const auto& segment : range)
+                {
+                    for (auto value : segment)
+                    {
+                        disorder[reader] += (value != expect);
+                        ++expect;
+                        ++count;
+                    }
+                }
+                if (count == 0)
+                    std::this_thread::yield();
+                ring.consume(reader, count);
+                received[reader] += int(count);
+            }
+        });
+    }
+
+    for (int k = 0; k < amount; ++k)
+        ring.push(k);
+    for (auto& thread : threads)
+        thread.join();
+
+    for (int reader = 0; reader < readers; ++reader)
+    {
+        TRIAL_TEST_EQ(received[reader], amount);
+        TRIAL_TEST_EQ(disorder[reader], 0);
+    }
+}
+
+// Readers receive increasing values and account for skipped values
+
+void concurrent_overwrite()
+{
+    const int amount = 100000;
+
+    circular::broadcast_ring<int> ring(16, 1, circular::broadcast_policy::overwrite);
+    int received = 0;
+    int disorder = 0;
+
+    std::thread thread([&ring, &received, &disorder] {
+        int last = -1;
+        int output = 0;
+        while (last < amount - 1)
+        {
+            if (ring.try_pop(0, output))
+            {
+                disorder += (output <= last);
+                last = output;
+                ++received;
+            }
+        }
+    });
+
+    for (int k = 0; k < amount; ++k)
+        ring.push(k);
+    thread.join();
+
+    TRIAL_TEST_EQ(disorder, 0);
+    TRIAL_TEST_EQ(received + int(ring.lag(0)), amount);
+}
+
+void run()
+{
+    concurrent_block();
+    concurrent_overwrite();
+}
+
+} // namespace concurrent_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    block_suite::run();
+    overwrite_suite::run();
+    concurrent_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,242 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/delay_line.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace tap_suite
+{
+
+void tap_empty()
+{
+    circular::delay_line<int, 4> line;
+    TRIAL_TEST_EQ(line.size(), 4);
+    TRIAL_TEST_EQ(line.capacity(), 4);
+    TRIAL_TEST_EQ(line.tap(0), 0);
+    TRIAL_TEST_EQ(line.tap(3), 0);
+}
+
+void tap_integer()
+{
+    circular::delay_line<int, 4> line;
+    line.push(11);
+    TRIAL_TEST_EQ(line.tap(0), 11);
+    TRIAL_TEST_EQ(line.tap(1), 0);
+    line.push(22);
+    line.push(33);
+    TRIAL_TEST_EQ(line.tap(0), 33);
+    TRIAL_TEST_EQ(line.tap(1), 22);
+    TRIAL_TEST_EQ(line.tap(2), 11);
+    TRIAL_TEST_EQ(line.tap(3), 0);
+    // Wraps around
+    line.push(44);
+    line.push(55);
+    TRIAL_TEST_EQ(line.tap(0), 55);
+    TRIAL_TEST_EQ(line.tap(1), 44);
+    TRIAL_TEST_EQ(line.tap(2), 33);
+    TRIAL_TEST_EQ(line.tap(3), 22);
+    {
+        std::vector<int> expect = { 22, 33, 44, 55 };
+        TRIAL_TEST_ALL_EQ(line.begin(), line.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void tap_clear()
+{
+    circular::delay_line<int, 4> line;
+    line.push(11);
+    line.push(22);
+    line.clear();
+    TRIAL_TEST_EQ(line.tap(0), 0);
+    TRIAL_TEST_EQ(line.tap(1), 0);
+}
+
+void tap_linear()
+{
+    circular::delay_line<double, 4> line;
+    line.push(10.0);
+    line.push(20.0);
+    line.push(30.0);
+    line.push(40.0);
+    line.push(50.0);
+    TRIAL_TEST_EQ(line.tap(0.0, circular::interpolation::linear{}), 50.0);
+    TRIAL_TEST_EQ(line.tap(0.5, circular::interpolation::linear{}), 45.0);
+    TRIAL_TEST_EQ(line.tap(1.25, circular::interpolation::linear{}), 37.5);
+    TRIAL_TEST_EQ(line.tap(2.0, circular::interpolation::linear{}), 30.0);
+}
+
+void tap_lagrange()
+{
+    // Third-order interpolation is exact for cubic polynomials
+    auto cubic = [](double x) { return x * x * x - 2.0 * x * x + 3.0; };
+    circular::delay_line<double, 16> line;
+    for (int k = 0; k < 20; ++k)
+        line.push(cubic(k));
+    const double newest = 19.0;
+    for (double delay = 0.0; delay <= 12.0; delay += 0.25)
+    {
+        const double value = line.tap(delay, circular::interpolation::lagrange<3>{});
+        TRIAL_TEST(std::abs(value - cubic(newest - delay)) < 1e-9);
+    }
+}
+
+void tap_lagrange_first_order()
+{
+    // First-order Lagrange interpolation is linear interpolation
+    circular::delay_line<double, 8> line;
+    for (int k = 0; k < 11; ++k)
+        line.push(k * k);
+    for (double delay = 0.0; delay < 7.0; delay += 0.5)
+    {
+        TRIAL_TEST_EQ(line.tap(delay, circular::interpolation::lagrange<1>{}),
+                      line.tap(delay, circular::interpolation::linear{}));
+    }
+}
+
+void tap_batch()
+{
+    circular::delay_line<int, 4> line;
+    for (int k = 1; k <= 6; ++k)
+        line.push(k * 11);
+    std::vector<int> delays = { 3, 0, 2, 1 };
+    std::vector<int> output(delays.size());
+    auto where = line.taps(delays.begin(), delays.end(), output.begin());
+    TRIAL_TEST(where == output.end());
+    std::vector<int> expect = { 33, 66, 44, 55 };
+    TRIAL_TEST_ALL_EQ(output.begin(), output.end(),
+                      expect.begin(), expect.end());
+}
+
+void tap_batch_fractional()
+{
+    circular::delay_line<double, 4> line;
+    for (int k = 1; k <= 6; ++k)
+        line.push(k * 10.0);
+    std::vector<double> delays = { 0.5, 2.0, 1.25 };
+    std::vector<double> output(delays.size());
+    line.taps(delays.begin(), delays.end(), output.begin(), circular::interpolation::linear{});
+    std::vector<double> expect = { 55.0, 40.0, 47.5 };
+    TRIAL_TEST_ALL_EQ(output.begin(), output.end(),
+                      expect.begin(), expect.end());
+}
+
+void run()
+{
+    tap_empty();
+    tap_integer();
+    tap_clear();
+    tap_linear();
+    tap_lagrange();
+    tap_lagrange_first_order();
+    tap_batch();
+    tap_batch_fractional();
+}
+
+} // namespace tap_suite
+
+//-----------------------------------------------------------------------------
+
+namespace process_suite
+{
+
+void process_integer()
+{
+    // Compare against a push followed by a tap for all delays and block sizes
+    for (std::size_t delay = 0; delay < 5; ++delay)
+    {
+        for (std::size_t block = 1; block < 13; ++block)
+        {
+            circular::delay_line<int, 5> line;
+            circular::delay_line<int, 5> expect_line;
+            std::vector<int> input(block);
+            std::vector<int> output(block);
+            std::vector<int> expect(block);
+            for (int round = 0; round < 3; ++round)
+            {
+                for (std::size_t k = 0; k < block; ++k)
+                {
+                    input[k] = int(round * 100 + k + 1);
+                    expect_line.push(input[k]);
+                    expect[k] = expect_line.tap(delay);
+                }
+                line.process(input.data(), output.data(), block, delay);
+                TRIAL_TEST_ALL_EQ(output.begin(), output.end(),
+                                  expect.begin(), expect.end());
+                TRIAL_TEST_ALL_EQ(line.begin(), line.end(),
+                                  expect_line.begin(), expect_line.end());
+            }
+        }
+    }
+}
+
+void process_in_place()
+{
+    circular::delay_line<int, 4> line;
+    std::vector<int> data = { 11, 22, 33, 44, 55, 66 };
+    line.process(data.data(), data.data(), data.size(), 2);
+    std::vector<int> expect = { 0, 0, 11, 22, 33, 44 };
+    TRIAL_TEST_ALL_EQ(data.begin(), data.end(),
+                      expect.begin(), expect.end());
+}
+
+template <typename Interpolation>
+void process_fractional(double delay)
+{
+    for (std::size_t block = 1; block < 20; ++block)
+    {
+        circular::delay_line<double, 8> line;
+        circular::delay_line<double, 8> expect_line;
+        std::vector<double> input(block);
+        std::vector<double> output(block);
+        for (int round = 0; round < 3; ++round)
+        {
+            for (std::size_t k = 0; k < block; ++k)
+                input[k] = std::sin(0.1 * (round * block + k));
+            line.process(input.data(), output.data(), block, delay, Interpolation{});
+            for (std::size_t k = 0; k < block; ++k)
+            {
+                expect_line.push(input[k]);
+                TRIAL_TEST(std::abs(output[k] - expect_line.tap(delay, Interpolation{})) < 1e-12);
+            }
+        }
+    }
+}
+
+void run()
+{
+    process_integer();
+    process_in_place();
+    process_fractional<circular::interpolation::linear>(0.25);
+    process_fractional<circular::interpolation::linear>(6.5);
+    process_fractional<circular::interpolation::lagrange<3>>(0.75);
+    process_fractional<circular::interpolation::lagrange<3>>(3.5);
+    process_fractional<circular::interpolation::lagrange<3>>(5.25);
+}
+
+} // namespace process_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    tap_suite::run();
+    process_suite::run();
+
+    return boost::report_errors();
+}
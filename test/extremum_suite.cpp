@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/extremum.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace max_suite
+{
+
+void max_empty()
+{
+    circular::window_max<int, 4> window;
+    TRIAL_TEST(window.empty());
+    TRIAL_TEST_EQ(window.size(), 0);
+    TRIAL_TEST_EQ(window.capacity(), 4);
+}
+
+void max_increasing()
+{
+    circular::window_max<int, 3> window;
+    window.push(11);
+    TRIAL_TEST_EQ(window.value(), 11);
+    window.push(22);
+    TRIAL_TEST_EQ(window.value(), 22);
+    window.push(33);
+    TRIAL_TEST_EQ(window.value(), 33);
+    window.push(44);
+    TRIAL_TEST_EQ(window.value(), 44);
+}
+
+void max_decreasing()
+{
+    circular::window_max<int, 3> window;
+    window.push(55);
+    TRIAL_TEST_EQ(window.value(), 55);
+    window.push(44);
+    TRIAL_TEST_EQ(window.value(), 55);
+    window.push(33);
+    TRIAL_TEST_EQ(window.value(), 55);
+    // 55 is evicted
+    window.push(22);
+    TRIAL_TEST_EQ(window.value(), 44);
+    window.push(11);
+    TRIAL_TEST_EQ(window.value(), 33);
+}
+
+void max_duplicates()
+{
+    circular::window_max<int, 2> window;
+    window.push(11);
+    window.push(11);
+    TRIAL_TEST_EQ(window.value(), 11);
+    window.push(0);
+    TRIAL_TEST_EQ(window.value(), 11);
+    window.push(0);
+    TRIAL_TEST_EQ(window.value(), 0);
+}
+
+void max_window()
+{
+    circular::window_max<int, 3> window;
+    window.push(11);
+    window.push(22);
+    window.push(33);
+    window.push(44);
+    std::vector<int> expect = { 22, 33, 44 };
+    TRIAL_TEST_ALL_EQ(window.begin(), window.end(), expect.begin(), expect.end());
+}
+
+void max_clear()
+{
+    circular::window_max<int, 3> window;
+    window.push(33);
+    window.push(22);
+    window.clear();
+    TRIAL_TEST(window.empty());
+    window.push(11);
+    TRIAL_TEST_EQ(window.value(), 11);
+}
+
+void run()
+{
+    max_empty();
+    max_increasing();
+    max_decreasing();
+    max_duplicates();
+    max_window();
+    max_clear();
+}
+
+} // namespace max_suite
+
+//-----------------------------------------------------------------------------
+
+namespace min_suite
+{
+
+void min_decreasing()
+{
+    circular::window_min<int, 3> window;
+    window.push(55);
+    TRIAL_TEST_EQ(window.value(), 55);
+    window.push(44);
+    TRIAL_TEST_EQ(window.value(), 44);
+    window.push(33);
+    TRIAL_TEST_EQ(window.value(), 33);
+    window.push(66);
+    TRIAL_TEST_EQ(window.value(), 33);
+}
+
+void min_increasing()
+{
+    circular::window_min<int, 3> window;
+    window.push(11);
+    window.push(22);
+    window.push(33);
+    TRIAL_TEST_EQ(window.value(), 11);
+    window.push(44);
+    TRIAL_TEST_EQ(window.value(), 22);
+    window.push(55);
+    TRIAL_TEST_EQ(window.value(), 33);
+}
+
+void run()
+{
+    min_decreasing();
+    min_increasing();
+}
+
+} // namespace min_suite
+
+//-----------------------------------------------------------------------------
+
+namespace random_suite
+{
+
+template <typename Window, typename Function>
+void compare_brute_force(Function function)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 100);
+    Window window;
+    std::vector<int> history;
+    for (int k = 0; k < 1000; ++k)
+    {
+        const int value = distribution(generator);
+        window.push(value);
+        history.push_back(value);
+        const auto first = history.end() - std::min(history.size(), window.capacity());
+        TRIAL_TEST_EQ(window.value(), *function(first, history.end()));
+    }
+}
+
+void random_max()
+{
+    compare_brute_force<circular::window_max<int, 7>>(std::max_element<std::vector<int>::iterator>);
+}
+
+void random_min()
+{
+    compare_brute_force<circular::window_min<int, 7>>(std::min_element<std::vector<int>::iterator>);
+}
+
+void run()
+{
+    random_max();
+    random_min();
+}
+
+} // namespace random_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    max_suite::run();
+    min_suite::run();
+    random_suite::run();
+
+    return boost::report_errors();
+}
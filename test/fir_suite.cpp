@@ -0,0 +1,237 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/fir.hpp>
+
+using namespace trial;
+
+// Convolution with zero samples before the first sample
+
+template <typename T>
+std::vector<T> convolve(const std::vector<T>& coefficients,
+                        const std::vector<T>& input)
+{
+    std::vector<T> result(input.size());
+    for (std::size_t n = 0; n < input.size(); ++n)
+    {
+        T sum{};
+        for (std::size_t k = 0; k < coefficients.size() && k <= n; ++k)
+            sum += coefficients[k] * input[n - k];
+        result[n] = sum;
+    }
+    return result;
+}
+
+template <typename T>
+std::vector<T> make_signal(std::size_t size)
+{
+    std::vector<T> result(size);
+    for (std::size_t k = 0; k < size; ++k)
+        result[k] = T(std::sin(0.05 * k) + std::cos(0.31 * k));
+    return result;
+}
+
+bool near(const std::vector<double>& lhs, const std::vector<double>& rhs)
+{
+    if (lhs.size() != rhs.size())
+        return false;
+    for (std::size_t k = 0; k < lhs.size(); ++k)
+    {
+        if (std::abs(lhs[k] - rhs[k]) > 1e-9)
+            return false;
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+namespace push_suite
+{
+
+void push_impulse()
+{
+    circular::fir<double, 2> filter = { 0.75, 0.25 };
+    TRIAL_TEST_EQ(filter.size(), 2);
+    TRIAL_TEST_EQ(filter.value(), 0.0);
+    filter.push(11.0);
+    TRIAL_TEST_EQ(filter.value(), 11.0 * 0.75);
+    filter.push(22.0);
+    TRIAL_TEST_EQ(filter.value(), 22.0 * 0.75 + 11.0 * 0.25);
+    filter.push(33.0);
+    TRIAL_TEST_EQ(filter.value(), 33.0 * 0.75 + 22.0 * 0.25);
+}
+
+void push_missing()
+{
+    circular::fir<int, 4> filter = { 1, 2 };
+    filter.push(1);
+    filter.push(10);
+    filter.push(100);
+    TRIAL_TEST_EQ(filter.value(), 100 + 2 * 10);
+}
+
+void push_integer()
+{
+    std::vector<int> coefficients = { 3, -1, 4, 1, -5 };
+    circular::fir<int, 5> filter(coefficients.begin(), coefficients.end());
+    std::vector<int> input = { 2, 7, 1, 8, 2, 8, 1, 8, 2, 8, 4, 5, 9 };
+    auto expect = convolve(coefficients, input);
+    for (std::size_t k = 0; k < input.size(); ++k)
+    {
+        filter.push(input[k]);
+        TRIAL_TEST_EQ(filter.value(), expect[k]);
+    }
+}
+
+void push_clear()
+{
+    circular::fir<int, 2> filter = { 1, 1 };
+    filter.push(11);
+    filter.push(22);
+    filter.clear();
+    TRIAL_TEST_EQ(filter.value(), 0);
+    filter.push(33);
+    TRIAL_TEST_EQ(filter.value(), 33);
+}
+
+void run()
+{
+    push_impulse();
+    push_missing();
+    push_integer();
+    push_clear();
+}
+
+} // namespace push_suite
+
+//-----------------------------------------------------------------------------
+
+namespace process_suite
+{
+
+void process_integer()
+{
+    // Exact results for all block sizes and starting positions
+    std::vector<int> coefficients = { 3, -1, 4, 1, -5, 9, 2 };
+    auto input = make_signal<int>(100);
+    for (std::size_t k = 0; k < input.size(); ++k)
+        input[k] = int(k * 7 % 13) - 6;
+    auto expect = convolve(coefficients, input);
+    for (std::size_t block = 1; block < 20; ++block)
+    {
+        circular::fir<int, 7> filter(coefficients.begin(), coefficients.end());
+        std::vector<int> output(input.size());
+        for (std::size_t offset = 0; offset < input.size(); offset += block)
+        {
+            const auto count = std::min(block, input.size() - offset);
+            filter.process(input.data() + offset, output.data() + offset, count);
+        }
+        TRIAL_TEST_ALL_EQ(output.begin(), output.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void process_mixed()
+{
+    // Interleave single pushes with blocks
+    std::vector<int> coefficients = { 1, 2, 3, 4 };
+    std::vector<int> input = { 1, -2, 3, -4, 5, -6, 7, -8, 9, -10, 11 };
+    auto expect = convolve(coefficients, input);
+    circular::fir<int, 4> filter(coefficients.begin(), coefficients.end());
+    filter.push(input[0]);
+    TRIAL_TEST_EQ(filter.value(), expect[0]);
+    std::vector<int> output(5);
+    filter.process(input.data() + 1, output.data(), 5);
+    TRIAL_TEST_ALL_EQ(output.begin(), output.end(),
+                      expect.begin() + 1, expect.begin() + 6);
+    filter.push(input[6]);
+    TRIAL_TEST_EQ(filter.value(), expect[6]);
+    filter.process(input.data() + 7, output.data(), 4);
+    TRIAL_TEST_ALL_EQ(output.begin(), output.begin() + 4,
+                      expect.begin() + 7, expect.end());
+}
+
+void process_in_place()
+{
+    std::vector<double> coefficients = { 0.5, 0.25, 0.125 };
+    auto data = make_signal<double>(50);
+    auto expect = convolve(coefficients, data);
+    circular::fir<double, 3> filter(coefficients.begin(), coefficients.end());
+    filter.process(data.data(), data.data(), data.size());
+    TRIAL_TEST(near(data, expect));
+}
+
+void process_transform()
+{
+    // Many coefficients use overlap-save convolution for long blocks
+    constexpr std::size_t size = 150;
+    std::vector<double> coefficients(size);
+    for (std::size_t k = 0; k < size; ++k)
+        coefficients[k] = 1.0 / (k + 1);
+    auto input = make_signal<double>(3000);
+    auto expect = convolve(coefficients, input);
+    for (std::size_t block : { 1, 37, 150, 401, 875, 1000, 3000 })
+    {
+        circular::fir<double, size> filter(coefficients.begin(), coefficients.end());
+        std::vector<double> output(input.size());
+        for (std::size_t offset = 0; offset < input.size(); offset += block)
+        {
+            const auto count = std::min(block, input.size() - offset);
+            filter.process(input.data() + offset, output.data() + offset, count);
+        }
+        TRIAL_TEST(near(output, expect));
+        // History continues after the blocks
+        filter.push(1.0);
+        double sum = coefficients[0];
+        for (std::size_t k = 1; k < size; ++k)
+            sum += coefficients[k] * input[input.size() - k];
+        TRIAL_TEST(std::abs(filter.value() - sum) < 1e-9);
+    }
+}
+
+void process_transform_in_place()
+{
+    constexpr std::size_t size = 128;
+    std::vector<double> coefficients(size);
+    for (std::size_t k = 0; k < size; ++k)
+        coefficients[k] = std::cos(0.1 * k);
+    auto data = make_signal<double>(1000);
+    auto expect = convolve(coefficients, data);
+    circular::fir<double, size> filter(coefficients.begin(), coefficients.end());
+    filter.process(data.data(), data.data(), data.size());
+    TRIAL_TEST(near(data, expect));
+}
+
+void run()
+{
+    process_integer();
+    process_mixed();
+    process_in_place();
+    process_transform();
+    process_transform_in_place();
+}
+
+} // namespace process_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    push_suite::run();
+    process_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,221 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/array.hpp>
+#include <trial/circular/inline_array.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace type_suite
+{
+
+void type_trivial()
+{
+    static_assert(std::is_trivially_copyable<circular::inline_array<int, 4>>::value, "");
+    static_assert(!std::is_trivially_copyable<circular::inline_array<std::string, 4>>::value, "");
+
+    // No pointer is stored
+    static_assert(sizeof(circular::inline_array<int, 4>) < sizeof(circular::array<int, 4>), "");
+    static_assert(sizeof(circular::inline_array<char, 12, std::uint16_t>) == 16, "");
+}
+
+void run()
+{
+    type_trivial();
+}
+
+} // namespace type_suite
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void api_empty()
+{
+    circular::inline_array<int, 4> data;
+    TRIAL_TEST(data.empty());
+    TRIAL_TEST(!data.full());
+    TRIAL_TEST_EQ(data.size(), 0);
+    TRIAL_TEST_EQ(data.capacity(), 4);
+    TRIAL_TEST(data.begin() == data.end());
+}
+
+void api_push_back()
+{
+    circular::inline_array<int, 4> data;
+    for (int k = 1; k <= 6; ++k)
+    {
+        data.push_back(k);
+    }
+    TRIAL_TEST(data.full());
+    TRIAL_TEST_EQ(data.front(), 3);
+    TRIAL_TEST_EQ(data.back(), 6);
+    TRIAL_TEST_EQ(data[1], 4);
+    {
+        std::vector<int> expect = { 3, 4, 5, 6 };
+        TRIAL_TEST_ALL_EQ(data.begin(), data.end(),
+                          expect.begin(), expect.end());
+    }
+    {
+        std::vector<int> expect = { 6, 5, 4, 3 };
+        TRIAL_TEST_ALL_EQ(data.rbegin(), data.rend(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void api_push_front()
+{
+    circular::inline_array<int, 4> data;
+    for (int k = 1; k <= 6; ++k)
+    {
+        data.push_front(k);
+    }
+    std::vector<int> expect = { 6, 5, 4, 3 };
+    TRIAL_TEST_ALL_EQ(data.begin(), data.end(),
+                      expect.begin(), expect.end());
+}
+
+void api_push_front_odd()
+{
+    // Capacity that is not a power of two
+    {
+        circular::inline_array<int, 3> data;
+        data.push_front(1);
+        data.push_front(2);
+        std::vector<int> expect = { 2, 1 };
+        TRIAL_TEST_ALL_EQ(data.begin(), data.end(),
+                          expect.begin(), expect.end());
+        data.push_front(3);
+        data.push_front(4);
+        expect = { 4, 3, 2 };
+        TRIAL_TEST_ALL_EQ(data.begin(), data.end(),
+                          expect.begin(), expect.end());
+    }
+    {
+        circular::inline_array<int, 3, std::uint16_t> data;
+        data.push_back(1);
+        data.push_front(2);
+        data.push_front(3);
+        std::vector<int> expect = { 3, 2, 1 };
+        TRIAL_TEST_ALL_EQ(data.begin(), data.end(),
+                          expect.begin(), expect.end());
+        data.push_back(4);
+        expect = { 2, 1, 4 };
+        TRIAL_TEST_ALL_EQ(data.begin(), data.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void api_pop()
+{
+    circular::inline_array<std::string, 3> data = { "alpha", "bravo", "charlie", "delta" };
+    TRIAL_TEST_EQ(data.size(), 3);
+    TRIAL_TEST_EQ(data.pop_front(), "bravo");
+    TRIAL_TEST_EQ(data.pop_back(), "delta");
+    TRIAL_TEST_EQ(data.size(), 1);
+    TRIAL_TEST_EQ(data.front(), "charlie");
+}
+
+void api_remove()
+{
+    circular::inline_array<int, 4> data = { 1, 2, 3, 4 };
+    data.remove_front(2);
+    TRIAL_TEST_EQ(data.front(), 3);
+    data.remove_back();
+    TRIAL_TEST_EQ(data.size(), 1);
+    data.clear();
+    TRIAL_TEST(data.empty());
+    data.push_back(5);
+    TRIAL_TEST_EQ(data.front(), 5);
+}
+
+void api_segments()
+{
+    circular::inline_array<int, 4> data = { 1, 2, 3, 4, 5 };
+    TRIAL_TEST_EQ(data.first_segment().size(), 3);
+    TRIAL_TEST_EQ(data.last_segment().size(), 1);
+    TRIAL_TEST_EQ(data.segments().size(), 2);
+    data.remove_front(2);
+    TRIAL_TEST_EQ(data.first_unused_segment().size(), 2);
+    TRIAL_TEST_EQ(data.last_unused_segment().size(), 0);
+    data.expand_back(2);
+    TRIAL_TEST(data.full());
+}
+
+void run()
+{
+    api_empty();
+    api_push_back();
+    api_push_front();
+    api_push_front_odd();
+    api_pop();
+    api_remove();
+    api_segments();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace copy_suite
+{
+
+void copy_assign()
+{
+    circular::inline_array<int, 4> data = { 1, 2, 3, 4, 5 };
+    auto copy = data;
+    data.clear();
+    copy.push_back(6);
+    std::vector<int> expect = { 3, 4, 5, 6 };
+    TRIAL_TEST_ALL_EQ(copy.begin(), copy.end(),
+                      expect.begin(), expect.end());
+}
+
+void copy_memcpy()
+{
+    circular::inline_array<int, 4> rings[2];
+    rings[0] = { 1, 2, 3, 4, 5 };
+    std::memcpy(&rings[1], &rings[0], sizeof(rings[0]));
+    rings[0].clear();
+    rings[1].push_back(6);
+    std::vector<int> expect = { 3, 4, 5, 6 };
+    TRIAL_TEST_ALL_EQ(rings[1].begin(), rings[1].end(),
+                      expect.begin(), expect.end());
+}
+
+void run()
+{
+    copy_assign();
+    copy_memcpy();
+}
+
+} // namespace copy_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    type_suite::run();
+    api_suite::run();
+    copy_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,294 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/span.hpp>
+#include <trial/circular/array.hpp>
+#include <trial/circular/vector.hpp>
+#include <trial/circular/io.hpp>
+
+using namespace trial;
+
+namespace
+{
+
+struct pipe_fixture
+{
+    pipe_fixture()
+    {
+        TRIAL_TEST_EQ(::pipe(fd), 0);
+        ::fcntl(fd[0], F_SETFL, ::fcntl(fd[0], F_GETFL) | O_NONBLOCK);
+        ::fcntl(fd[1], F_SETFL, ::fcntl(fd[1], F_GETFL) | O_NONBLOCK);
+    }
+
+    ~pipe_fixture()
+    {
+        close_input();
+        close_output();
+    }
+
+    void close_input()
+    {
+        if (fd[0] != -1)
+            ::close(fd[0]);
+        fd[0] = -1;
+    }
+
+    void close_output()
+    {
+        if (fd[1] != -1)
+            ::close(fd[1]);
+        fd[1] = -1;
+    }
+
+    int input() const { return fd[0]; }
+    int output() const { return fd[1]; }
+
+    int fd[2];
+};
+
+bool would_block(const std::error_code& error)
+{
+    return (error == std::errc::operation_would_block) || (error == std::errc::resource_unavailable_try_again);
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+
+namespace read_suite
+{
+
+void read_empty()
+{
+    pipe_fixture pipe;
+    circular::array<char, 4> buffer;
+    std::error_code error;
+    TRIAL_TEST_EQ(circular::read_from(pipe.input(), buffer, error), 0);
+    TRIAL_TEST(would_block(error));
+    TRIAL_TEST(buffer.empty());
+}
+
+void read_short()
+{
+    pipe_fixture pipe;
+    TRIAL_TEST_EQ(::write(pipe.output(), "ab", 2), 2);
+    circular::array<char, 4> buffer;
+    std::error_code error;
+    TRIAL_TEST_EQ(circular::read_from(pipe.input(), buffer, error), 2);
+    TRIAL_TEST(!error);
+    std::string expect = "ab";
+    TRIAL_TEST_ALL_EQ(buffer.begin(), buffer.end(), expect.begin(), expect.end());
+}
+
+void read_wraparound()
+{
+    pipe_fixture pipe;
+    TRIAL_TEST_EQ(::write(pipe.output(), "cdefgh", 6), 6);
+    char storage[4] = {};
+    circular::span<char> buffer(storage);
+    buffer = { 'a', 'b', 'x' };
+    buffer.remove_front(2);
+    std::error_code error;
+    TRIAL_TEST_EQ(circular::read_from(pipe.input(), buffer, error), 3);
+    TRIAL_TEST(!error);
+    TRIAL_TEST(buffer.full());
+    {
+        std::string expect = "xcde";
+        TRIAL_TEST_ALL_EQ(buffer.begin(), buffer.end(), expect.begin(), expect.end());
+    }
+    buffer.remove_front(4);
+    TRIAL_TEST_EQ(circular::read_from(pipe.input(), buffer, error), 3);
+    {
+        std::string expect = "fgh";
+        TRIAL_TEST_ALL_EQ(buffer.begin(), buffer.end(), expect.begin(), expect.end());
+    }
+}
+
+void read_end_of_file()
+{
+    pipe_fixture pipe;
+    pipe.close_output();
+    circular::vector<char> buffer(4);
+    std::error_code error;
+    TRIAL_TEST_EQ(circular::read_from(pipe.input(), buffer, error), 0);
+    TRIAL_TEST(!error);
+}
+
+void read_bad_descriptor()
+{
+    circular::vector<char> buffer(4);
+    std::error_code error;
+    TRIAL_TEST_EQ(circular::read_from(-1, buffer, error), 0);
+    TRIAL_TEST(error == std::errc::bad_file_descriptor);
+}
+
+void run()
+{
+    read_empty();
+    read_short();
+    read_wraparound();
+    read_end_of_file();
+    read_bad_descriptor();
+}
+
+} // namespace read_suite
+
+//-----------------------------------------------------------------------------
+
+namespace write_suite
+{
+
+void write_empty()
+{
+    pipe_fixture pipe;
+    circular::array<char, 4> buffer;
+    std::error_code error;
+    TRIAL_TEST_EQ(circular::write_to(pipe.output(), buffer, error), 0);
+    TRIAL_TEST(!error);
+}
+
+void write_wraparound()
+{
+    pipe_fixture pipe;
+    circular::vector<char> buffer(4);
+    for (auto value : std::string("abcdef"))
+    {
+        buffer.push_back(value);
+    }
+    std::error_code error;
+    TRIAL_TEST_EQ(circular::write_to(pipe.output(), buffer, error), 4);
+    TRIAL_TEST(!error);
+    TRIAL_TEST(buffer.empty());
+
+    char result[8] = {};
+    TRIAL_TEST_EQ(::read(pipe.input(), result, sizeof(result)), 4);
+    std::string expect = "cdef";
+    TRIAL_TEST_ALL_EQ(result, result + 4, expect.begin(), expect.end());
+}
+
+void write_would_block()
+{
+    pipe_fixture pipe;
+    circular::vector<char> buffer(4096);
+    std::error_code error;
+    std::size_t total = 0;
+    for (int k = 0; k < 1024; ++k)
+    {
+        for (std::size_t i = 0; i < buffer.capacity(); ++i)
+        {
+            buffer.push_back('a');
+        }
+        total += circular::write_to(pipe.output(), buffer, error);
+        if (error)
+            break;
+    }
+    TRIAL_TEST(would_block(error));
+    TRIAL_TEST(total > 0);
+}
+
+void write_broken_pipe()
+{
+    int fd[2];
+    TRIAL_TEST_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fd), 0);
+    ::close(fd[1]);
+    circular::array<char, 4> buffer = { 'a', 'b' };
+    std::error_code error;
+    TRIAL_TEST_EQ(circular::write_to(fd[0], buffer, MSG_NOSIGNAL, error), 0);
+    TRIAL_TEST(error == std::errc::broken_pipe);
+    TRIAL_TEST_EQ(buffer.size(), 2);
+    ::close(fd[0]);
+}
+
+void write_zero()
+{
+    // Writes one byte and then nothing
+    circular::array<char, 4> buffer = { 'a', 'b', 'c' };
+    std::error_code error;
+    int calls = 0;
+    auto function = [&calls] (struct iovec *, int) -> ssize_t
+                    {
+                        return (calls++ == 0) ? 1 : 0;
+                    };
+    TRIAL_TEST_EQ(circular::detail::write_all(buffer, error, function), 1);
+    TRIAL_TEST(error == std::errc::io_error);
+    TRIAL_TEST_EQ(calls, 2);
+    TRIAL_TEST_EQ(buffer.size(), 2);
+    TRIAL_TEST_EQ(buffer.front(), 'b');
+}
+
+void run()
+{
+    write_empty();
+    write_wraparound();
+    write_would_block();
+    write_broken_pipe();
+    write_zero();
+}
+
+} // namespace write_suite
+
+//-----------------------------------------------------------------------------
+
+namespace socket_suite
+{
+
+void roundtrip()
+{
+    int fd[2];
+    TRIAL_TEST_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fd), 0);
+
+    circular::array<char, 4> output;
+    output.push_back('a');
+    output.push_back('b');
+    output.remove_front(2);
+    output.push_back('c');
+    output.push_back('d');
+    output.push_back('e');
+    std::error_code error;
+    TRIAL_TEST_EQ(circular::write_to(fd[0], output, MSG_NOSIGNAL, error), 3);
+    TRIAL_TEST(!error);
+
+    circular::array<char, 4> input;
+    TRIAL_TEST_EQ(circular::read_from(fd[1], input, MSG_DONTWAIT, error), 3);
+    TRIAL_TEST(!error);
+    std::string expect = "cde";
+    TRIAL_TEST_ALL_EQ(input.begin(), input.end(), expect.begin(), expect.end());
+
+    TRIAL_TEST_EQ(circular::read_from(fd[1], input, MSG_DONTWAIT, error), 0);
+    TRIAL_TEST(would_block(error));
+
+    ::close(fd[0]);
+    ::close(fd[1]);
+}
+
+void run()
+{
+    roundtrip();
+}
+
+} // namespace socket_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    read_suite::run();
+    write_suite::run();
+    socket_suite::run();
+
+    return boost::report_errors();
+}
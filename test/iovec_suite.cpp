@@ -0,0 +1,255 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <string>
+#include <unistd.h>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/span.hpp>
+#include <trial/circular/array.hpp>
+#include <trial/circular/vector.hpp>
+#include <trial/circular/iovec.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace used_suite
+{
+
+void used_empty()
+{
+    char storage[4] = {};
+    circular::span<char> span(storage);
+    struct iovec iov[2];
+    TRIAL_TEST_EQ(circular::used_iovec(span, iov), 0);
+    TRIAL_TEST_EQ(iov[0].iov_len, 0);
+    TRIAL_TEST_EQ(iov[1].iov_len, 0);
+}
+
+void used_partial()
+{
+    char storage[4] = {};
+    circular::span<char> span(storage);
+    span = { 'a', 'b' };
+    struct iovec iov[2];
+    TRIAL_TEST_EQ(circular::used_iovec(span, iov), 1);
+    TRIAL_TEST(iov[0].iov_base == &storage[0]);
+    TRIAL_TEST_EQ(iov[0].iov_len, 2);
+    TRIAL_TEST_EQ(iov[1].iov_len, 0);
+}
+
+void used_overfull()
+{
+    char storage[4] = {};
+    circular::span<char> span(storage);
+    // e f c d
+    // --> <--
+    span = { 'a', 'b', 'c', 'd', 'e', 'f' };
+    struct iovec iov[2];
+    TRIAL_TEST_EQ(circular::used_iovec(span, iov), 2);
+    TRIAL_TEST(iov[0].iov_base == &storage[2]);
+    TRIAL_TEST_EQ(iov[0].iov_len, 2);
+    TRIAL_TEST(iov[1].iov_base == &storage[0]);
+    TRIAL_TEST_EQ(iov[1].iov_len, 2);
+}
+
+void used_bytes()
+{
+    circular::array<int, 4> array = { 11, 22, 33 };
+    struct iovec iov[2];
+    TRIAL_TEST_EQ(circular::used_iovec(array, iov), 1);
+    TRIAL_TEST(iov[0].iov_base == &array.front());
+    TRIAL_TEST_EQ(iov[0].iov_len, 3 * sizeof(int));
+}
+
+void run()
+{
+    used_empty();
+    used_partial();
+    used_overfull();
+    used_bytes();
+}
+
+} // namespace used_suite
+
+//-----------------------------------------------------------------------------
+
+namespace unused_suite
+{
+
+void unused_empty()
+{
+    char storage[4] = {};
+    circular::span<char> span(storage);
+    struct iovec iov[2];
+    TRIAL_TEST_EQ(circular::unused_iovec(span, iov), 1);
+    TRIAL_TEST(iov[0].iov_base == &storage[0]);
+    TRIAL_TEST_EQ(iov[0].iov_len, 4);
+    TRIAL_TEST_EQ(iov[1].iov_len, 0);
+}
+
+void unused_full()
+{
+    char storage[4] = {};
+    circular::span<char> span(storage);
+    span = { 'a', 'b', 'c', 'd' };
+    struct iovec iov[2];
+    TRIAL_TEST_EQ(circular::unused_iovec(span, iov), 0);
+}
+
+void unused_wraparound()
+{
+    char storage[4] = {};
+    circular::span<char> span(storage);
+    // _ b c _
+    span = { 'a', 'b', 'c' };
+    span.remove_front();
+    struct iovec iov[2];
+    TRIAL_TEST_EQ(circular::unused_iovec(span, iov), 2);
+    TRIAL_TEST(iov[0].iov_base == &storage[3]);
+    TRIAL_TEST_EQ(iov[0].iov_len, 1);
+    TRIAL_TEST(iov[1].iov_base == &storage[0]);
+    TRIAL_TEST_EQ(iov[1].iov_len, 1);
+}
+
+void unused_const_segment()
+{
+    char storage[4] = {};
+    circular::span<char> span(storage);
+    span = { 'a', 'b', 'c' };
+    span.remove_front();
+    const circular::span<char>& cspan = span;
+    TRIAL_TEST(cspan.first_unused_segment().data() == &storage[3]);
+    TRIAL_TEST_EQ(cspan.first_unused_segment().size(), 1);
+    TRIAL_TEST(cspan.last_unused_segment().data() == &storage[0]);
+    TRIAL_TEST_EQ(cspan.last_unused_segment().size(), 1);
+}
+
+void unused_preloaded()
+{
+    char storage[4] = { 'a', 'b', 'c', 'd' };
+    circular::span<char> span(storage, storage + 4, storage + 2, 1);
+    struct iovec iov[2];
+    TRIAL_TEST_EQ(circular::unused_iovec(span, iov), 2);
+    TRIAL_TEST(iov[0].iov_base == &storage[3]);
+    TRIAL_TEST_EQ(iov[0].iov_len, 1);
+    TRIAL_TEST(iov[1].iov_base == &storage[0]);
+    TRIAL_TEST_EQ(iov[1].iov_len, 2);
+}
+
+void run()
+{
+    unused_empty();
+    unused_full();
+    unused_wraparound();
+    unused_const_segment();
+    unused_preloaded();
+}
+
+} // namespace unused_suite
+
+//-----------------------------------------------------------------------------
+
+namespace advance_suite
+{
+
+void consume_partial()
+{
+    char storage[4] = {};
+    circular::span<char> span(storage);
+    span = { 'a', 'b', 'c', 'd', 'e', 'f' };
+    circular::consume(span, 0);
+    TRIAL_TEST_EQ(span.size(), 4);
+    circular::consume(span, 3);
+    TRIAL_TEST_EQ(span.size(), 1);
+    TRIAL_TEST_EQ(span.front(), 'f');
+}
+
+void produce_partial()
+{
+    char storage[4] = {};
+    circular::span<char> span(storage);
+    span = { 'a', 'b', 'c' };
+    span.remove_front(2);
+    struct iovec iov[2];
+    circular::unused_iovec(span, iov);
+    static_cast<char *>(iov[0].iov_base)[0] = 'x';
+    static_cast<char *>(iov[1].iov_base)[0] = 'y';
+    circular::produce(span, 0);
+    TRIAL_TEST_EQ(span.size(), 1);
+    circular::produce(span, 2);
+    std::string expect = "cxy";
+    TRIAL_TEST_ALL_EQ(span.begin(), span.end(), expect.begin(), expect.end());
+}
+
+void roundtrip_pipe()
+{
+    int fd[2];
+    TRIAL_TEST_EQ(::pipe(fd), 0);
+
+    circular::vector<char> output(4);
+    output.push_back('a');
+    output.push_back('b');
+    output.push_back('c');
+    output.push_back('d');
+    output.push_back('e');
+    output.push_back('f');
+    {
+        struct iovec iov[2];
+        auto count = circular::used_iovec(output, iov);
+        TRIAL_TEST_EQ(count, 2);
+        auto written = ::writev(fd[1], iov, int(count));
+        TRIAL_TEST_EQ(written, 4);
+        circular::consume(output, std::size_t(written));
+        TRIAL_TEST(output.empty());
+    }
+    circular::vector<char> input(4);
+    input.push_back('z');
+    input.push_back('z');
+    input.push_back('z');
+    input.remove_front(2);
+    {
+        struct iovec iov[2];
+        auto count = circular::unused_iovec(input, iov);
+        TRIAL_TEST_EQ(count, 2);
+        auto received = ::readv(fd[0], iov, int(count));
+        TRIAL_TEST_EQ(received, 3);
+        circular::produce(input, std::size_t(received));
+        TRIAL_TEST(input.full());
+    }
+    std::string expect = "zcde";
+    TRIAL_TEST_ALL_EQ(input.begin(), input.end(), expect.begin(), expect.end());
+
+    ::close(fd[0]);
+    ::close(fd[1]);
+}
+
+void run()
+{
+    consume_partial();
+    produce_partial();
+    roundtrip_pipe();
+}
+
+} // namespace advance_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    used_suite::run();
+    unused_suite::run();
+    advance_suite::run();
+
+    return boost::report_errors();
+}
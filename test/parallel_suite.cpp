@@ -0,0 +1,252 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/array.hpp>
+#include <trial/circular/vector.hpp>
+#include <trial/circular/parallel.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace policy_suite
+{
+
+void policy_chunks()
+{
+    circular::chunked_policy policy(4, 10);
+    TRIAL_TEST_EQ(policy.threads(), 4);
+    TRIAL_TEST_EQ(policy.grain(), 10);
+    TRIAL_TEST_EQ(policy.chunks(0), 0);
+    TRIAL_TEST_EQ(policy.chunks(1), 1);
+    TRIAL_TEST_EQ(policy.chunks(19), 1);
+    TRIAL_TEST_EQ(policy.chunks(20), 2);
+    TRIAL_TEST_EQ(policy.chunks(1000), 100);
+}
+
+void policy_chunks_threads()
+{
+    // Chunks do not depend on the number of threads
+    circular::chunked_policy single(1, 10);
+    circular::chunked_policy many(8, 10);
+    circular::chunked_policy hardware(0, 10);
+    TRIAL_TEST_EQ(single.chunks(1000), many.chunks(1000));
+    TRIAL_TEST_EQ(single.chunks(1000), hardware.chunks(1000));
+}
+
+void policy_hardware()
+{
+    circular::chunked_policy policy;
+    TRIAL_TEST(policy.threads() > 0);
+}
+
+void run()
+{
+    policy_chunks();
+    policy_chunks_threads();
+    policy_hardware();
+}
+
+} // namespace policy_suite
+
+//-----------------------------------------------------------------------------
+
+namespace reduce_suite
+{
+
+// Circular vector that wraps around the storage
+
+circular::vector<int> make_wrapped(int capacity, int amount)
+{
+    circular::vector<int> data(capacity);
+    for (int k = 0; k < amount; ++k)
+        data.push_back(k);
+    return data;
+}
+
+void reduce_empty()
+{
+    circular::array<int, 4> data;
+    circular::chunked_policy policy(4, 1);
+    TRIAL_TEST_EQ(circular::reduce(policy, data, 42), 42);
+}
+
+void reduce_wrapped()
+{
+    auto data = make_wrapped(1000, 1500);
+    TRIAL_TEST_EQ(data.first_segment().size(), 500);
+    const int expect = std::accumulate(data.begin(), data.end(), 0);
+    for (std::size_t threads = 1; threads <= 8; ++threads)
+    {
+        circular::chunked_policy policy(threads, 1);
+        TRIAL_TEST_EQ(circular::reduce(policy, data, 0), expect);
+    }
+}
+
+void reduce_order()
+{
+    // String concatenation is not commutative
+    circular::array<std::string, 5> data = { "a", "b", "c", "d", "e" };
+    data.push_back("f");
+    data.push_back("g");
+    circular::chunked_policy policy(3, 1);
+    TRIAL_TEST_EQ(circular::reduce(policy, data, std::string(">")), ">cdefg");
+}
+
+void reduce_deterministic()
+{
+    circular::vector<double> data(1000);
+    for (int k = 0; k < 1700; ++k)
+        data.push_back(1.0 / (k + 1));
+    circular::chunked_policy policy(4, 1);
+    const double expect = circular::reduce(policy, data, 0.0);
+    for (int k = 0; k < 10; ++k)
+    {
+        TRIAL_TEST_EQ(circular::reduce(policy, data, 0.0), expect);
+    }
+}
+
+void reduce_deterministic_threads()
+{
+    circular::vector<double> data(1000);
+    for (int k = 0; k < 1700; ++k)
+        data.push_back(1.0 / (k + 1));
+    const double expect = circular::reduce(circular::chunked_policy(1, 7), data, 0.0);
+    for (std::size_t threads = 2; threads <= 16; ++threads)
+    {
+        circular::chunked_policy policy(threads, 7);
+        TRIAL_TEST_EQ(circular::reduce(policy, data, 0.0), expect);
+    }
+    TRIAL_TEST_EQ(circular::reduce(circular::chunked_policy(0, 7), data, 0.0), expect);
+}
+
+void transform_reduce_wrapped()
+{
+    auto data = make_wrapped(100, 150);
+    long long expect = 0;
+    for (auto value : data)
+        expect += (long long)value * value;
+    circular::chunked_policy policy(3, 1);
+    TRIAL_TEST_EQ(circular::transform_reduce(policy,
+                                             data,
+                                             0LL,
+                                             [](long long lhs, long long rhs) { return lhs + rhs; },
+                                             [](int value) { return (long long)value * value; }),
+                  expect);
+}
+
+void reduce_exception()
+{
+    auto data = make_wrapped(100, 150);
+    circular::chunked_policy policy(4, 1);
+    bool caught = false;
+    try
+    {
+        circular::reduce(policy, data, 0, [](int lhs, int rhs) {
+            if (rhs == 120)
+                throw std::runtime_error("reduce");
+            return lhs + rhs;
+        });
+    }
+    catch (const std::runtime_error&)
+    {
+        caught = true;
+    }
+    TRIAL_TEST(caught);
+}
+
+void run()
+{
+    reduce_empty();
+    reduce_wrapped();
+    reduce_order();
+    reduce_deterministic();
+    reduce_deterministic_threads();
+    transform_reduce_wrapped();
+    reduce_exception();
+}
+
+} // namespace reduce_suite
+
+//-----------------------------------------------------------------------------
+
+namespace copy_suite
+{
+
+void copy_wrapped()
+{
+    auto data = reduce_suite::make_wrapped(1000, 1500);
+    for (std::size_t threads = 1; threads <= 5; ++threads)
+    {
+        std::vector<int> output(data.size());
+        circular::chunked_policy policy(threads, 1);
+        auto where = circular::copy(policy, data, output.begin());
+        TRIAL_TEST(where == output.end());
+        TRIAL_TEST_ALL_EQ(output.begin(), output.end(),
+                          data.begin(), data.end());
+    }
+}
+
+void run()
+{
+    copy_wrapped();
+}
+
+} // namespace copy_suite
+
+//-----------------------------------------------------------------------------
+
+namespace execution_suite
+{
+
+void execution_reduce()
+{
+#if TRIAL_CIRCULAR_EXECUTION
+    auto data = reduce_suite::make_wrapped(1000, 1500);
+    const int expect = std::accumulate(data.begin(), data.end(), 0);
+    TRIAL_TEST_EQ(circular::reduce(std::execution::seq, data, 0), expect);
+    TRIAL_TEST_EQ(circular::transform_reduce(std::execution::seq,
+                                             data,
+                                             0,
+                                             [](int lhs, int rhs) { return lhs + rhs; },
+                                             [](int value) { return 2 * value; }),
+                  2 * expect);
+    std::vector<int> output(data.size());
+    circular::copy(std::execution::seq, data, output.begin());
+    TRIAL_TEST_ALL_EQ(output.begin(), output.end(),
+                      data.begin(), data.end());
+#endif
+}
+
+void run()
+{
+    execution_reduce();
+}
+
+} // namespace execution_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    policy_suite::run();
+    reduce_suite::run();
+    copy_suite::run();
+    execution_suite::run();
+
+    return boost::report_errors();
+}
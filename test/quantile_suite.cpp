@@ -0,0 +1,279 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/quantile.hpp>
+
+using namespace trial;
+
+namespace
+{
+
+// Nearest-rank quantile by selection as reference
+
+template <typename Iterator>
+typename std::iterator_traits<Iterator>::value_type
+reference(Iterator first, Iterator last, double probability)
+{
+    std::vector<typename std::iterator_traits<Iterator>::value_type> copy(first, last);
+    std::size_t rank = std::size_t(std::ceil(probability * copy.size()));
+    rank = (rank == 0) ? 0 : std::min(rank, copy.size()) - 1;
+    std::nth_element(copy.begin(), copy.begin() + rank, copy.end());
+    return copy[rank];
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void api_empty()
+{
+    circular::quantile<int, 4> window;
+    TRIAL_TEST(window.empty());
+    TRIAL_TEST(!window.full());
+    TRIAL_TEST_EQ(window.size(), 0);
+    TRIAL_TEST_EQ(window.capacity(), 4);
+}
+
+void api_dynamic()
+{
+    circular::quantile<int> window(4);
+    TRIAL_TEST(window.empty());
+    TRIAL_TEST_EQ(window.capacity(), 4);
+    window.push(1);
+    TRIAL_TEST_EQ(window.size(), 1);
+    TRIAL_TEST_EQ(window.value(0.5), 1);
+}
+
+void api_median()
+{
+    circular::quantile<int, 4> window;
+    window.push(30);
+    TRIAL_TEST_EQ(window.value(0.5), 30);
+    window.push(10);
+    TRIAL_TEST_EQ(window.value(0.5), 10);
+    window.push(20);
+    TRIAL_TEST_EQ(window.value(0.5), 20);
+    window.push(40);
+    TRIAL_TEST_EQ(window.value(0.5), 20);
+    TRIAL_TEST(window.full());
+    // Evict 30
+    window.push(50);
+    TRIAL_TEST_EQ(window.value(0.5), 20);
+    // Evict 10
+    window.push(60);
+    TRIAL_TEST_EQ(window.value(0.5), 40);
+    {
+        std::vector<int> expect = { 20, 40, 50, 60 };
+        TRIAL_TEST_ALL_EQ(window.begin(), window.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void api_order()
+{
+    circular::quantile<int, 4> window;
+    window.push(3);
+    window.push(1);
+    window.push(4);
+    window.push(1);
+    window.push(5);
+    TRIAL_TEST_EQ(window.order(0), 1);
+    TRIAL_TEST_EQ(window.order(1), 1);
+    TRIAL_TEST_EQ(window.order(2), 4);
+    TRIAL_TEST_EQ(window.order(3), 5);
+    TRIAL_TEST_EQ(window.value(0.0), 1);
+    TRIAL_TEST_EQ(window.value(1.0), 5);
+}
+
+void api_compare()
+{
+    circular::quantile<int, 4, std::greater<int>> window;
+    window.push(1);
+    window.push(2);
+    window.push(3);
+    window.push(4);
+    TRIAL_TEST_EQ(window.order(0), 4);
+    TRIAL_TEST_EQ(window.order(3), 1);
+}
+
+void api_clear()
+{
+    circular::quantile<int, 4> window;
+    window.push(1);
+    window.push(2);
+    window.clear();
+    TRIAL_TEST(window.empty());
+    window.push(3);
+    TRIAL_TEST_EQ(window.value(0.5), 3);
+}
+
+void run()
+{
+    api_empty();
+    api_dynamic();
+    api_median();
+    api_order();
+    api_compare();
+    api_clear();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace histogram_suite
+{
+
+void histogram_empty()
+{
+    circular::histogram_quantile<int, 4> window(10);
+    TRIAL_TEST(window.empty());
+    TRIAL_TEST_EQ(window.capacity(), 4);
+    TRIAL_TEST_EQ(window.limit(), 10);
+}
+
+void histogram_median()
+{
+    circular::histogram_quantile<int, 4> window(100);
+    window.push(30);
+    window.push(10);
+    window.push(20);
+    window.push(40);
+    TRIAL_TEST_EQ(window.value(0.5), 20);
+    window.push(50);
+    TRIAL_TEST_EQ(window.value(0.5), 20);
+    window.push(60);
+    TRIAL_TEST_EQ(window.value(0.5), 40);
+    TRIAL_TEST_EQ(window.order(0), 20);
+    TRIAL_TEST_EQ(window.order(3), 60);
+}
+
+void histogram_saturate()
+{
+    circular::histogram_quantile<int> window(4, 10);
+    window.push(-5);
+    window.push(100);
+    TRIAL_TEST_EQ(window.order(0), 0);
+    TRIAL_TEST_EQ(window.order(1), 9);
+}
+
+void histogram_clear()
+{
+    circular::histogram_quantile<unsigned, 2> window(10u);
+    window.push(7);
+    window.push(8);
+    window.clear();
+    TRIAL_TEST(window.empty());
+    window.push(3);
+    TRIAL_TEST_EQ(window.value(1.0), 3u);
+}
+
+void run()
+{
+    histogram_empty();
+    histogram_median();
+    histogram_saturate();
+    histogram_clear();
+}
+
+} // namespace histogram_suite
+
+//-----------------------------------------------------------------------------
+
+namespace random_suite
+{
+
+void random_sorted()
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 50);
+    const double probabilities[] = { 0.0, 0.1, 0.5, 0.9, 0.99, 1.0 };
+    circular::quantile<int> window(17);
+    for (int k = 0; k < 500; ++k)
+    {
+        window.push(distribution(generator));
+        for (auto probability : probabilities)
+        {
+            TRIAL_TEST_EQ(window.value(probability),
+                          reference(window.begin(), window.end(), probability));
+        }
+    }
+}
+
+void random_order()
+{
+    // Every rank after each insertion and eviction, with duplicate values
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> distribution(0, 20);
+    circular::quantile<int, 100> window;
+    for (int round = 0; round < 2; ++round)
+    {
+        for (int k = 0; k < 1000; ++k)
+        {
+            window.push(distribution(generator));
+            std::vector<int> expect(window.begin(), window.end());
+            std::sort(expect.begin(), expect.end());
+            for (std::size_t position = 0; position < expect.size(); ++position)
+            {
+                TRIAL_TEST_EQ(window.order(position), expect[position]);
+            }
+        }
+        window.clear();
+        TRIAL_TEST(window.empty());
+    }
+}
+
+void random_histogram()
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 50);
+    const double probabilities[] = { 0.0, 0.1, 0.5, 0.9, 0.99, 1.0 };
+    circular::histogram_quantile<int, 17> window(51);
+    for (int k = 0; k < 500; ++k)
+    {
+        window.push(distribution(generator));
+        for (auto probability : probabilities)
+        {
+            TRIAL_TEST_EQ(window.value(probability),
+                          reference(window.begin(), window.end(), probability));
+        }
+    }
+}
+
+void run()
+{
+    random_sorted();
+    random_order();
+    random_histogram();
+}
+
+} // namespace random_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    histogram_suite::run();
+    random_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/rollup.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void api_empty()
+{
+    circular::rollup<int, circular::aggregate::sum, 4, 3, 2> data;
+    TRIAL_TEST(data.empty());
+    TRIAL_TEST_EQ(data.level<0>().capacity(), 4);
+    TRIAL_TEST_EQ(data.level<1>().capacity(), 3);
+    TRIAL_TEST_EQ(data.level<2>().capacity(), 2);
+}
+
+void api_single_level()
+{
+    circular::rollup<int, circular::aggregate::sum, 4> data;
+    for (int k = 1; k <= 6; ++k)
+        data.push(k);
+    TRIAL_TEST_EQ(data.query(1), 6);
+    TRIAL_TEST_EQ(data.query(4), 3 + 4 + 5 + 6);
+    TRIAL_TEST_EQ(data.query(10), 3 + 4 + 5 + 6);
+}
+
+void api_cascade()
+{
+    circular::rollup<int, circular::aggregate::sum, 4, 3, 2> data;
+    for (int k = 1; k <= 10; ++k)
+        data.push(k);
+    {
+        std::vector<int> expect = { 7, 8, 9, 10 };
+        TRIAL_TEST_ALL_EQ(data.level<0>().begin(), data.level<0>().end(),
+                          expect.begin(), expect.end());
+    }
+    {
+        std::vector<int> expect = { 1 + 2 + 3 + 4, 5 + 6 + 7 + 8 };
+        TRIAL_TEST_ALL_EQ(data.level<1>().begin(), data.level<1>().end(),
+                          expect.begin(), expect.end());
+    }
+    TRIAL_TEST(data.level<2>().empty());
+
+    data.push(11);
+    data.push(12);
+    {
+        std::vector<int> expect = { 1 + 2 + 3 + 4 + 5 + 6 + 7 + 8 + 9 + 10 + 11 + 12 };
+        TRIAL_TEST_ALL_EQ(data.level<2>().begin(), data.level<2>().end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void api_clear()
+{
+    circular::rollup<int, circular::aggregate::sum, 2, 2> data;
+    for (int k = 1; k <= 5; ++k)
+        data.push(k);
+    data.clear();
+    TRIAL_TEST(data.empty());
+    TRIAL_TEST(data.level<1>().empty());
+    data.push(7);
+    data.push(8);
+    TRIAL_TEST_EQ(data.level<1>().back(), 15);
+}
+
+void run()
+{
+    api_empty();
+    api_single_level();
+    api_cascade();
+    api_clear();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace query_suite
+{
+
+void query_partial_bucket()
+{
+    circular::rollup<int, circular::aggregate::sum, 4, 3, 2> data;
+    for (int k = 1; k <= 10; ++k)
+        data.push(k);
+    // Exact within first level
+    TRIAL_TEST_EQ(data.query(1), 10);
+    TRIAL_TEST_EQ(data.query(4), 7 + 8 + 9 + 10);
+    // Rounded up to bucket [5, 8]
+    TRIAL_TEST_EQ(data.query(5), 5 + 6 + 7 + 8 + 9 + 10);
+    TRIAL_TEST_EQ(data.query(6), 5 + 6 + 7 + 8 + 9 + 10);
+    // Rounded up to bucket [1, 4]
+    TRIAL_TEST_EQ(data.query(7), 55);
+    // Limited by history
+    TRIAL_TEST_EQ(data.query(100), 55);
+}
+
+void query_aligned_bucket()
+{
+    circular::rollup<int, circular::aggregate::sum, 4, 3, 2> data;
+    for (int k = 1; k <= 12; ++k)
+        data.push(k);
+    TRIAL_TEST_EQ(data.query(4), 9 + 10 + 11 + 12);
+    TRIAL_TEST_EQ(data.query(8), 5 + 6 + 7 + 8 + 9 + 10 + 11 + 12);
+    TRIAL_TEST_EQ(data.query(12), 78);
+}
+
+void query_coarsest()
+{
+    circular::rollup<int, circular::aggregate::count, 2, 2, 2> data;
+    for (int k = 0; k < 100; ++k)
+        data.push(k);
+    // Coarsest level retains two buckets of four samples
+    TRIAL_TEST_EQ(data.query(1), 1);
+    TRIAL_TEST_EQ(data.query(2), 2);
+    TRIAL_TEST_EQ(data.query(3), 4);
+    TRIAL_TEST_EQ(data.query(5), 8);
+    TRIAL_TEST_EQ(data.query(1000), 8);
+}
+
+void query_min_max()
+{
+    circular::rollup<int, circular::aggregate::min, 3, 3> low;
+    circular::rollup<int, circular::aggregate::max, 3, 3> high;
+    const int input[] = { 5, 1, 9, 4, 7, 6, 8 };
+    for (auto value : input)
+    {
+        low.push(value);
+        high.push(value);
+    }
+    TRIAL_TEST_EQ(low.query(3), 6);
+    TRIAL_TEST_EQ(low.query(7), 1);
+    TRIAL_TEST_EQ(high.query(2), 8);
+    TRIAL_TEST_EQ(high.query(7), 9);
+}
+
+void query_last()
+{
+    circular::rollup<int, circular::aggregate::last, 2, 2> data;
+    for (int k = 1; k <= 5; ++k)
+        data.push(k);
+    TRIAL_TEST_EQ(data.level<1>().back(), 4);
+    TRIAL_TEST_EQ(data.query(5), 5);
+}
+
+void run()
+{
+    query_partial_bucket();
+    query_aligned_bucket();
+    query_coarsest();
+    query_min_max();
+    query_last();
+}
+
+} // namespace query_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    query_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,199 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/snapshot_ring.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void api_empty()
+{
+    circular::snapshot_ring<int, 4> ring;
+    TRIAL_TEST_EQ(ring.capacity(), 4);
+    TRIAL_TEST_EQ(ring.count(), 0);
+    int output[4] = {};
+    TRIAL_TEST_EQ(ring.snapshot(output), 0);
+    TRIAL_TEST(ring.snapshot().empty());
+    std::size_t size = 42;
+    TRIAL_TEST(ring.try_snapshot(output, size));
+    TRIAL_TEST_EQ(size, 0);
+}
+
+void api_partial()
+{
+    circular::snapshot_ring<int, 4> ring;
+    ring.push(11);
+    ring.push(22);
+    TRIAL_TEST_EQ(ring.count(), 2);
+    int output[4] = {};
+    TRIAL_TEST_EQ(ring.snapshot(output), 2);
+    {
+        std::vector<int> expect = { 11, 22 };
+        TRIAL_TEST_ALL_EQ(output, output + 2,
+                          expect.begin(), expect.end());
+    }
+    std::size_t size = 0;
+    TRIAL_TEST(ring.try_snapshot(output, size));
+    TRIAL_TEST_EQ(size, 2);
+}
+
+void api_wraparound()
+{
+    circular::snapshot_ring<int, 4> ring;
+    ring.push(11);
+    ring.push(22);
+    ring.push(33);
+    ring.push(44);
+    ring.push(55);
+    ring.push(66);
+    TRIAL_TEST_EQ(ring.count(), 6);
+    int output[4] = {};
+    TRIAL_TEST_EQ(ring.snapshot(output), 4);
+    {
+        std::vector<int> expect = { 33, 44, 55, 66 };
+        TRIAL_TEST_ALL_EQ(output, output + 4,
+                          expect.begin(), expect.end());
+    }
+    auto copy = ring.snapshot();
+    TRIAL_TEST(copy.full());
+    {
+        std::vector<int> expect = { 33, 44, 55, 66 };
+        TRIAL_TEST_ALL_EQ(copy.begin(), copy.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void run()
+{
+    api_empty();
+    api_partial();
+    api_wraparound();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace concurrent_suite
+{
+
+// Snapshots must contain consecutive values while the writer keeps appending
+
+void concurrent_snapshot()
+{
+    const int amount = 200000;
+    const int readers = 2;
+    const std::size_t capacity = 8;
+
+    circular::snapshot_ring<int, capacity> ring;
+    std::atomic<bool> done(false);
+    std::vector<int> inconsistent(readers, 0);
+    std::vector<int> snapshots(readers, 0);
+
+    std::vector<std::thread> threads;
+    for (int reader = 0; reader < readers; ++reader)
+    {
+        threads.emplace_back([&ring, &done, &inconsistent, &snapshots, reader] {
+            int output[capacity];
+            do
+            {
+                const auto size = ring.snapshot(output);
+                for (std::size_t k = 1; k < size; ++k)
+                {
+                    inconsistent[reader] += (output[k] != output[k - 1] + 1);
+                }
+                ++snapshots[reader];
+            } while (!done.load());
+        });
+    }
+
+    for (int k = 0; k < amount; ++k)
+        ring.push(k);
+    done.store(true);
+    for (auto& thread : threads)
+        thread.join();
+
+    for (int reader = 0; reader < readers; ++reader)
+    {
+        TRIAL_TEST_EQ(inconsistent[reader], 0);
+        TRIAL_TEST(snapshots[reader] > 0);
+    }
+    int output[capacity];
+    TRIAL_TEST_EQ(ring.snapshot(output), capacity);
+    TRIAL_TEST_EQ(output[capacity - 1], amount - 1);
+}
+
+// Single attempts fail while the writer is appending, and are consistent
+// whenever they succeed
+
+void concurrent_try_snapshot()
+{
+    const std::size_t capacity = 1024;
+
+    circular::snapshot_ring<int, capacity> ring;
+    std::atomic<bool> done(false);
+    int failures = 0;
+    int inconsistent = 0;
+
+    std::thread reader([&ring, &done, &failures, &inconsistent] {
+        int output[capacity];
+        while (failures == 0)
+        {
+            std::size_t size = 0;
+            if (ring.try_snapshot(output, size))
+            {
+                for (std::size_t k = 1; k < size; ++k)
+                {
+                    inconsistent += (output[k] != output[k - 1] + 1);
+                }
+            }
+            else
+            {
+                ++failures;
+            }
+        }
+        done.store(true);
+    });
+
+    for (int k = 0; !done.load(); ++k)
+        ring.push(k);
+    reader.join();
+
+    TRIAL_TEST(failures > 0);
+    TRIAL_TEST_EQ(inconsistent, 0);
+}
+
+void run()
+{
+    concurrent_snapshot();
+    concurrent_try_snapshot();
+}
+
+} // namespace concurrent_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    concurrent_suite::run();
+
+    return boost::report_errors();
+}
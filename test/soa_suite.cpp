@@ -0,0 +1,358 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/soa.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void api_empty()
+{
+    circular::soa_array<4, int, double> data;
+    TRIAL_TEST(data.empty());
+    TRIAL_TEST(!data.full());
+    TRIAL_TEST_EQ(data.size(), 0);
+    TRIAL_TEST_EQ(data.capacity(), 4);
+    TRIAL_TEST(data.column<1>().empty());
+}
+
+void api_dynamic()
+{
+    circular::soa_vector<int, double> data(4);
+    TRIAL_TEST(data.empty());
+    TRIAL_TEST_EQ(data.capacity(), 4);
+    data.push_back(1, 1.5);
+    TRIAL_TEST_EQ(data.size(), 1);
+    TRIAL_TEST(data[0] == std::make_tuple(1, 1.5));
+}
+
+void api_push_back()
+{
+    circular::soa_array<4, int, double> data;
+    data.push_back(1, 1.5);
+    data.push_back(2, 2.5);
+    data.push_back(3, 3.5);
+    TRIAL_TEST_EQ(data.size(), 3);
+    TRIAL_TEST_EQ(data.column<0>().front(), 1);
+    TRIAL_TEST_EQ(data.column<1>().back(), 3.5);
+    {
+        std::vector<double> expect = { 1.5, 2.5, 3.5 };
+        TRIAL_TEST_ALL_EQ(data.column<1>().begin(), data.column<1>().end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void api_push_back_overflow()
+{
+    circular::soa_array<2, int, std::string> data;
+    data.push_back(1, "alpha");
+    data.push_back(2, "bravo");
+    data.push_back(3, "charlie");
+    TRIAL_TEST(data.full());
+    TRIAL_TEST(data[0] == std::make_tuple(2, std::string("bravo")));
+    TRIAL_TEST(data[1] == std::make_tuple(3, std::string("charlie")));
+}
+
+// Copying throws, but moving does not
+
+struct throwing_copy
+{
+    throwing_copy(int value = 0) : value(value) {}
+    throwing_copy(const throwing_copy& other) : value(other.value)
+    {
+        if (value < 0)
+            throw std::runtime_error("copy");
+    }
+    throwing_copy(throwing_copy&&) noexcept = default;
+    throwing_copy& operator=(throwing_copy&&) noexcept = default;
+
+    int value;
+};
+
+void api_push_back_throw()
+{
+    circular::soa_array<2, int, throwing_copy> data;
+    data.push_back(1, throwing_copy(11));
+    data.push_back(2, throwing_copy(22));
+    const throwing_copy input(-1);
+    try
+    {
+        data.push_back(3, input);
+        TRIAL_TEST(false);
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+    TRIAL_TEST_EQ(data.size(), 2);
+    TRIAL_TEST_EQ(std::get<0>(data[0]), 1);
+    TRIAL_TEST_EQ(std::get<1>(data[0]).value, 11);
+    TRIAL_TEST_EQ(std::get<0>(data[1]), 2);
+    TRIAL_TEST_EQ(std::get<1>(data[1]).value, 22);
+}
+
+void api_push_front()
+{
+    circular::soa_array<2, int, char> data;
+    data.push_front(1, 'a');
+    data.push_front(2, 'b');
+    data.push_front(3, 'c');
+    TRIAL_TEST(data[0] == std::make_tuple(3, 'c'));
+    TRIAL_TEST(data[1] == std::make_tuple(2, 'b'));
+}
+
+void api_remove()
+{
+    circular::soa_array<4, int, char> data;
+    data.push_back(1, 'a');
+    data.push_back(2, 'b');
+    data.push_back(3, 'c');
+    data.remove_front();
+    TRIAL_TEST(data[0] == std::make_tuple(2, 'b'));
+    data.remove_back();
+    TRIAL_TEST_EQ(data.size(), 1);
+    TRIAL_TEST_EQ(data.column<1>().back(), 'b');
+    data.clear();
+    TRIAL_TEST(data.empty());
+}
+
+void api_column_modify()
+{
+    circular::soa_array<4, int, double> data;
+    data.push_back(1, 1.5);
+    data.push_back(2, 2.5);
+    for (auto& value : data.column<1>())
+    {
+        value *= 2;
+    }
+    TRIAL_TEST(data[0] == std::make_tuple(1, 3.0));
+    TRIAL_TEST(data[1] == std::make_tuple(2, 5.0));
+}
+
+void run()
+{
+    api_empty();
+    api_dynamic();
+    api_push_back();
+    api_push_back_overflow();
+    api_push_back_throw();
+    api_push_front();
+    api_remove();
+    api_column_modify();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace segment_suite
+{
+
+void segment_wraparound()
+{
+    circular::soa_array<4, int, double> data;
+    for (int k = 1; k <= 6; ++k)
+    {
+        data.push_back(k, k + 0.5);
+    }
+    const auto segments = data.segments<1>();
+    TRIAL_TEST_EQ(segments.size(), 2);
+    {
+        std::vector<double> expect = { 3.5, 4.5 };
+        TRIAL_TEST_ALL_EQ(segments.begin()->begin(), segments.begin()->end(),
+                          expect.begin(), expect.end());
+    }
+    {
+        std::vector<double> expect = { 5.5, 6.5 };
+        TRIAL_TEST_ALL_EQ((segments.begin() + 1)->begin(), (segments.begin() + 1)->end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void segment_const()
+{
+    circular::soa_vector<int, double> data(4);
+    for (int k = 1; k <= 5; ++k)
+    {
+        data.push_back(k, k + 0.5);
+    }
+    const auto& cdata = data;
+    double total = 0.0;
+    for (const auto& segment : cdata.segments<1>())
+    {
+        for (auto value : segment)
+        {
+            total += value;
+        }
+    }
+    TRIAL_TEST_EQ(total, 2.5 + 3.5 + 4.5 + 5.5);
+}
+
+void run()
+{
+    segment_wraparound();
+    segment_const();
+}
+
+} // namespace segment_suite
+
+//-----------------------------------------------------------------------------
+
+namespace copy_suite
+{
+
+void copy_array()
+{
+    circular::soa_array<4, int, double> data;
+    for (int k = 1; k <= 6; ++k)
+    {
+        data.push_back(k, k + 0.5);
+    }
+    circular::soa_array<4, int, double> copy(data);
+    data.clear();
+    TRIAL_TEST_EQ(copy.size(), 4);
+    TRIAL_TEST(copy[0] == std::make_tuple(3, 3.5));
+    TRIAL_TEST(copy[3] == std::make_tuple(6, 6.5));
+    copy.push_back(7, 7.5);
+    TRIAL_TEST(copy[0] == std::make_tuple(4, 4.5));
+}
+
+void move_array()
+{
+    circular::soa_array<4, int, double> data;
+    for (int k = 1; k <= 5; ++k)
+    {
+        data.push_back(k, k + 0.5);
+    }
+    circular::soa_array<4, int, double> other;
+    other = std::move(data);
+    TRIAL_TEST_EQ(other.size(), 4);
+    TRIAL_TEST(other[0] == std::make_tuple(2, 2.5));
+    TRIAL_TEST(other[3] == std::make_tuple(5, 5.5));
+}
+
+void copy_push_front()
+{
+    // Capacity that is not a power of two
+    circular::soa_array<3, int, double> data;
+    data.push_back(1, 1.5);
+    circular::soa_array<3, int, double> copy(data);
+    copy.push_front(0, 0.5);
+    TRIAL_TEST_EQ(copy.size(), 2);
+    TRIAL_TEST(copy[0] == std::make_tuple(0, 0.5));
+    TRIAL_TEST(copy[1] == std::make_tuple(1, 1.5));
+
+    circular::soa_array<3, int, double> other;
+    other = std::move(copy);
+    other.push_front(-1, -0.5);
+    TRIAL_TEST_EQ(other.size(), 3);
+    TRIAL_TEST(other[0] == std::make_tuple(-1, -0.5));
+    TRIAL_TEST(other[2] == std::make_tuple(1, 1.5));
+}
+
+void move_vector()
+{
+    circular::soa_vector<int, std::string> data(2);
+    data.push_back(1, "alpha");
+    data.push_back(2, "bravo");
+    data.push_back(3, "charlie");
+    circular::soa_vector<int, std::string> other(std::move(data));
+    TRIAL_TEST_EQ(other.size(), 2);
+    TRIAL_TEST(other[0] == std::make_tuple(2, std::string("bravo")));
+    TRIAL_TEST(other[1] == std::make_tuple(3, std::string("charlie")));
+}
+
+void move_array_reuse()
+{
+    circular::soa_array<4, int, double> data;
+    data.push_back(1, 1.5);
+    data.push_back(2, 2.5);
+    circular::soa_array<4, int, double> other(std::move(data));
+    TRIAL_TEST_EQ(other.size(), 2);
+    TRIAL_TEST(data.empty());
+    TRIAL_TEST_EQ(data.capacity(), 4);
+    data.push_back(3, 3.5);
+    TRIAL_TEST_EQ(data.size(), 1);
+    TRIAL_TEST(data[0] == std::make_tuple(3, 3.5));
+    data.clear();
+    TRIAL_TEST(data.empty());
+
+    other.push_back(4, 4.5);
+    data = std::move(other);
+    TRIAL_TEST_EQ(data.size(), 3);
+    TRIAL_TEST(other.empty());
+    other.push_front(5, 5.5);
+    TRIAL_TEST_EQ(other.size(), 1);
+    TRIAL_TEST(other[0] == std::make_tuple(5, 5.5));
+    other.clear();
+    TRIAL_TEST(other.empty());
+}
+
+void move_vector_reuse()
+{
+    circular::soa_vector<int, double> data(4);
+    data.push_back(1, 1.5);
+    data.push_back(2, 2.5);
+    circular::soa_vector<int, double> other(std::move(data));
+    TRIAL_TEST_EQ(other.size(), 2);
+    TRIAL_TEST(data.empty());
+    TRIAL_TEST_EQ(data.size(), 0);
+    TRIAL_TEST_EQ(data.capacity(), 0);
+    data.clear();
+    TRIAL_TEST(data.empty());
+    data = circular::soa_vector<int, double>(2);
+    data.push_back(99, 9.0);
+    TRIAL_TEST_EQ(data.size(), 1);
+    TRIAL_TEST(data[0] == std::make_tuple(99, 9.0));
+
+    data = std::move(other);
+    TRIAL_TEST_EQ(data.size(), 2);
+    TRIAL_TEST(data[1] == std::make_tuple(2, 2.5));
+    TRIAL_TEST(other.empty());
+    TRIAL_TEST_EQ(other.capacity(), 0);
+    other.clear();
+    TRIAL_TEST(other.empty());
+    other = circular::soa_vector<int, double>(2);
+    other.push_front(3, 3.5);
+    TRIAL_TEST(other[0] == std::make_tuple(3, 3.5));
+}
+
+void run()
+{
+    copy_array();
+    move_array();
+    copy_push_front();
+    move_vector();
+    move_array_reuse();
+    move_vector_reuse();
+}
+
+} // namespace copy_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    segment_suite::run();
+    copy_suite::run();
+
+    return boost::report_errors();
+}
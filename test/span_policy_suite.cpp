@@ -0,0 +1,559 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/span.hpp>
+#include <trial/circular/array.hpp>
+#include <trial/circular/vector.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace type_suite
+{
+
+struct counting
+    : circular::policy::basic
+{
+    std::size_t stats() const noexcept { return pushes; }
+
+    void on_push(std::size_t count, std::size_t) noexcept { pushes += count; }
+
+    std::size_t pushes = 0;
+};
+
+void type_size()
+{
+    // Default policy adds nothing
+    static_assert(sizeof(circular::span<int, circular::dynamic_extent, std::size_t, circular::policy::basic>) == sizeof(int *) + 3 * sizeof(std::size_t), "");
+    static_assert(sizeof(circular::span<int, 4, std::size_t, circular::policy::basic>) == sizeof(int *) + 2 * sizeof(std::size_t), "");
+    static_assert(sizeof(circular::span<int, 4, std::size_t, circular::policy::statistics>) > sizeof(circular::span<int, 4>), "");
+}
+
+void custom_policy()
+{
+    int storage[2];
+    circular::span<int, 2, std::size_t, counting> span(storage);
+    span.push_back(11);
+    span.push_back(22);
+    span.push_back(33);
+    TRIAL_TEST_EQ(span.size(), 2);
+    TRIAL_TEST_EQ(span.front(), 22);
+    TRIAL_TEST_EQ(span.stats(), 3);
+}
+
+void run()
+{
+    type_size();
+    custom_policy();
+}
+
+} // namespace type_suite
+
+//-----------------------------------------------------------------------------
+
+namespace span_suite
+{
+
+using span_type = circular::span<int, 4, std::size_t, circular::policy::statistics>;
+
+void stats_empty()
+{
+    int storage[4];
+    span_type span(storage);
+    TRIAL_TEST_EQ(span.stats().pushes, 0);
+    TRIAL_TEST_EQ(span.stats().pops, 0);
+    TRIAL_TEST_EQ(span.stats().overwrites, 0);
+    TRIAL_TEST_EQ(span.stats().wraparounds, 0);
+    TRIAL_TEST_EQ(span.stats().high_water, 0);
+}
+
+void stats_push_back()
+{
+    int storage[4];
+    span_type span(storage);
+    span.push_back(11);
+    span.push_back(22);
+    span.push_back(33);
+    TRIAL_TEST_EQ(span.stats().pushes, 3);
+    TRIAL_TEST_EQ(span.stats().overwrites, 0);
+    TRIAL_TEST_EQ(span.stats().wraparounds, 0);
+    TRIAL_TEST_EQ(span.stats().high_water, 3);
+    span.push_back(44);
+    TRIAL_TEST_EQ(span.stats().wraparounds, 1);
+    span.push_back(55);
+    span.push_back(66);
+    TRIAL_TEST_EQ(span.stats().pushes, 6);
+    TRIAL_TEST_EQ(span.stats().overwrites, 2);
+    TRIAL_TEST_EQ(span.stats().wraparounds, 1);
+    TRIAL_TEST_EQ(span.stats().high_water, 4);
+}
+
+void stats_push_front()
+{
+    int storage[4];
+    span_type span(storage);
+    span.push_front(11);
+    TRIAL_TEST_EQ(span.stats().wraparounds, 1);
+    span.push_front(22);
+    span.push_front(33);
+    span.push_front(44);
+    span.push_front(55);
+    TRIAL_TEST_EQ(span.stats().pushes, 5);
+    TRIAL_TEST_EQ(span.stats().overwrites, 1);
+    TRIAL_TEST_EQ(span.stats().wraparounds, 2);
+    TRIAL_TEST_EQ(span.stats().high_water, 4);
+}
+
+void stats_pop()
+{
+    int storage[4];
+    span_type span(storage);
+    span = { 11, 22, 33 };
+    span.pop_front();
+    span.pop_back();
+    TRIAL_TEST_EQ(span.stats().pushes, 3);
+    TRIAL_TEST_EQ(span.stats().pops, 2);
+    TRIAL_TEST_EQ(span.stats().high_water, 3);
+    span.clear();
+    TRIAL_TEST_EQ(span.stats().pops, 3);
+}
+
+void stats_copy()
+{
+    int storage[4];
+    span_type span(storage);
+    span.push_back(11);
+    span_type clone(span);
+    TRIAL_TEST_EQ(clone.stats().pushes, 1);
+}
+
+void run()
+{
+    stats_empty();
+    stats_push_back();
+    stats_push_front();
+    stats_pop();
+    stats_copy();
+}
+
+} // namespace span_suite
+
+//-----------------------------------------------------------------------------
+
+namespace array_suite
+{
+
+void stats_push_back()
+{
+    circular::array<int, 2, std::size_t, circular::policy::statistics> array;
+    array.push_back(11);
+    array.push_back(22);
+    array.push_back(33);
+    TRIAL_TEST_EQ(array.stats().pushes, 3);
+    TRIAL_TEST_EQ(array.stats().overwrites, 1);
+    TRIAL_TEST_EQ(array.stats().high_water, 2);
+    array.pop_front();
+    TRIAL_TEST_EQ(array.stats().pops, 1);
+}
+
+void stats_copy()
+{
+    circular::array<int, 2, std::size_t, circular::policy::statistics> array;
+    array.push_back(11);
+    auto clone = array;
+    TRIAL_TEST_EQ(clone.stats().pushes, 1);
+    decltype(array) other;
+    other = array;
+    TRIAL_TEST_EQ(other.stats().pushes, 1);
+}
+
+void run()
+{
+    stats_push_back();
+    stats_copy();
+}
+
+} // namespace array_suite
+
+//-----------------------------------------------------------------------------
+
+namespace vector_suite
+{
+
+using vector_type = circular::vector<int, std::allocator<int>, circular::policy::statistics>;
+
+void stats_push_back()
+{
+    vector_type vector(2);
+    vector.push_back(11);
+    vector.push_back(22);
+    vector.push_back(33);
+    TRIAL_TEST_EQ(vector.stats().pushes, 3);
+    TRIAL_TEST_EQ(vector.stats().overwrites, 1);
+    TRIAL_TEST_EQ(vector.stats().high_water, 2);
+}
+
+void stats_reserve()
+{
+    vector_type vector;
+    vector.reserve(4);
+    vector.push_back(11);
+    vector.push_back(22);
+    vector.push_front(33);
+    TRIAL_TEST_EQ(vector.size(), 3);
+    TRIAL_TEST_EQ(vector.stats().pushes, 3);
+    TRIAL_TEST_EQ(vector.stats().overwrites, 0);
+    TRIAL_TEST_EQ(vector.stats().high_water, 3);
+    // Statistics are kept when storage is reallocated
+    vector.reserve(8);
+    TRIAL_TEST_EQ(vector.stats().pushes, 3);
+}
+
+void run()
+{
+    stats_push_back();
+    stats_reserve();
+}
+
+} // namespace vector_suite
+
+//-----------------------------------------------------------------------------
+
+namespace evict_suite
+{
+
+// Spills evicted elements into a vector and records the segment sizes
+
+struct spill
+    : circular::policy::basic
+{
+    template <typename Segment>
+    void on_evict(Segment segment) noexcept
+    {
+        segments.push_back(segment.size());
+        for (auto&& value : segment)
+            spilled.push_back(std::move(value));
+    }
+
+    std::vector<int> spilled;
+    std::vector<std::size_t> segments;
+};
+
+using span_type = circular::span<int, 4, std::size_t, spill>;
+
+void evict_push_back()
+{
+    int storage[4];
+    span_type span(storage);
+    span = { 11, 22, 33, 44 };
+    TRIAL_TEST(span.get_policy().spilled.empty());
+    span.push_back(55);
+    span.push_back(66);
+    {
+        std::vector<int> expect = { 11, 22 };
+        TRIAL_TEST_ALL_EQ(span.get_policy().spilled.begin(), span.get_policy().spilled.end(),
+                          expect.begin(), expect.end());
+    }
+    {
+        std::vector<int> expect = { 33, 44, 55, 66 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void evict_push_front()
+{
+    int storage[4];
+    span_type span(storage);
+    span = { 11, 22, 33, 44 };
+    span.push_front(55);
+    span.push_front(66);
+    {
+        std::vector<int> expect = { 44, 33 };
+        TRIAL_TEST_ALL_EQ(span.get_policy().spilled.begin(), span.get_policy().spilled.end(),
+                          expect.begin(), expect.end());
+    }
+    {
+        std::vector<int> expect = { 66, 55, 11, 22 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void evict_range_push_back()
+{
+    int storage[4];
+    span_type span(storage);
+    span = { 11, 22, 33, 44 };
+    span.push_back(55);
+    span.get_policy().segments.clear();
+    // Storage: [55][22][33][44]
+    std::vector<int> input = { 66, 77, 88, 99 };
+    span.push_back(input.begin(), input.end());
+    {
+        // Evicted elements wrap around the storage
+        std::vector<std::size_t> expect = { 3, 1 };
+        TRIAL_TEST_ALL_EQ(span.get_policy().segments.begin(), span.get_policy().segments.end(),
+                          expect.begin(), expect.end());
+    }
+    {
+        std::vector<int> expect = { 11, 22, 33, 44, 55 };
+        TRIAL_TEST_ALL_EQ(span.get_policy().spilled.begin(), span.get_policy().spilled.end(),
+                          expect.begin(), expect.end());
+    }
+    TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                      input.begin(), input.end());
+}
+
+void evict_range_push_front()
+{
+    int storage[4];
+    span_type span(storage);
+    span = { 11, 22 };
+    std::vector<int> input = { 33, 44, 55 };
+    span.push_front(input.begin(), input.end());
+    {
+        std::vector<std::size_t> expect = { 1 };
+        TRIAL_TEST_ALL_EQ(span.get_policy().segments.begin(), span.get_policy().segments.end(),
+                          expect.begin(), expect.end());
+    }
+    {
+        std::vector<int> expect = { 22 };
+        TRIAL_TEST_ALL_EQ(span.get_policy().spilled.begin(), span.get_policy().spilled.end(),
+                          expect.begin(), expect.end());
+    }
+    {
+        std::vector<int> expect = { 55, 44, 33, 11 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void evict_range_larger()
+{
+    int storage[4];
+    span_type span(storage);
+    span = { 11, 22 };
+    std::vector<int> input = { 33, 44, 55, 66, 77, 88 };
+    span.push_back(input.begin(), input.end());
+    {
+        std::vector<int> expect = { 11, 22, 33, 44 };
+        TRIAL_TEST_ALL_EQ(span.get_policy().spilled.begin(), span.get_policy().spilled.end(),
+                          expect.begin(), expect.end());
+    }
+    {
+        std::vector<int> expect = { 55, 66, 77, 88 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void evict_vector()
+{
+    circular::vector<int, std::allocator<int>, spill> vector(2);
+    vector.push_back(11);
+    vector.push_back(22);
+    vector.push_back(33);
+    TRIAL_TEST_EQ(vector.get_policy().spilled.size(), 1);
+    TRIAL_TEST_EQ(vector.get_policy().spilled.front(), 11);
+}
+
+void run()
+{
+    evict_push_back();
+    evict_push_front();
+    evict_range_push_back();
+    evict_range_push_front();
+    evict_range_larger();
+    evict_vector();
+}
+
+} // namespace evict_suite
+
+//-----------------------------------------------------------------------------
+
+namespace overflow_suite
+{
+
+void try_push_back()
+{
+    int storage[2];
+    circular::span<int, 2> span(storage);
+    TRIAL_TEST(span.try_push_back(11));
+    TRIAL_TEST(span.try_push_back(22));
+    TRIAL_TEST(!span.try_push_back(33));
+    {
+        std::vector<int> expect = { 11, 22 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void try_push_back_range()
+{
+    int storage[4];
+    circular::span<int, 4> span(storage);
+    span.push_back(11);
+    std::vector<int> input = { 22, 33, 44, 55, 66 };
+    TRIAL_TEST_EQ(span.try_push_back(input.begin(), input.end()), 3);
+    TRIAL_TEST_EQ(span.try_push_back(input.begin(), input.end()), 0);
+    {
+        std::vector<int> expect = { 11, 22, 33, 44 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void try_push_front()
+{
+    int storage[2];
+    circular::span<int, 2> span(storage);
+    TRIAL_TEST(span.try_push_front(11));
+    TRIAL_TEST(span.try_push_front(22));
+    TRIAL_TEST(!span.try_push_front(33));
+    {
+        std::vector<int> expect = { 22, 11 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void try_push_front_range()
+{
+    int storage[4];
+    circular::span<int, 4> span(storage);
+    span.push_back(11);
+    std::vector<int> input = { 22, 33, 44, 55 };
+    TRIAL_TEST_EQ(span.try_push_front(input.begin(), input.end()), 3);
+    {
+        std::vector<int> expect = { 44, 33, 22, 11 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void reject_push_back()
+{
+    circular::array<int, 2, std::size_t, circular::policy::reject> array;
+    array.push_back(11);
+    array.push_back(22);
+    array.push_back(33);
+    array.push_front(44);
+    {
+        std::vector<int> expect = { 11, 22 };
+        TRIAL_TEST_ALL_EQ(array.begin(), array.end(),
+                          expect.begin(), expect.end());
+    }
+    array.pop_front();
+    array.push_back(55);
+    {
+        std::vector<int> expect = { 22, 55 };
+        TRIAL_TEST_ALL_EQ(array.begin(), array.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void reject_push_back_range()
+{
+    circular::array<int, 4, std::size_t, circular::policy::reject> array;
+    std::vector<int> input = { 11, 22, 33, 44, 55, 66 };
+    array.push_back(input.begin(), input.end());
+    {
+        std::vector<int> expect = { 11, 22, 33, 44 };
+        TRIAL_TEST_ALL_EQ(array.begin(), array.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void reject_expand()
+{
+    circular::array<int, 4, std::size_t, circular::policy::reject> array = { 11, 22, 33 };
+    TRIAL_TEST_EQ(array.expand_back(2), 1);
+    array.back() = 44;
+    TRIAL_TEST_EQ(array.expand_back(), 0);
+    TRIAL_TEST_EQ(array.expand_front(), 0);
+    {
+        std::vector<int> expect = { 11, 22, 33, 44 };
+        TRIAL_TEST_ALL_EQ(array.begin(), array.end(),
+                          expect.begin(), expect.end());
+    }
+    array.pop_back();
+    array.pop_back();
+    TRIAL_TEST_EQ(array.expand_front(4), 2);
+    array[0] = 55;
+    array[1] = 66;
+    {
+        std::vector<int> expect = { 55, 66, 11, 22 };
+        TRIAL_TEST_ALL_EQ(array.begin(), array.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void overwrite_expand()
+{
+    circular::array<int, 4> array = { 11, 22, 33 };
+    TRIAL_TEST_EQ(array.expand_back(2), 2);
+    array[2] = 44;
+    array[3] = 55;
+    {
+        std::vector<int> expect = { 22, 33, 44, 55 };
+        TRIAL_TEST_ALL_EQ(array.begin(), array.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void vector_try_push_back()
+{
+    circular::vector<int> vector;
+    vector.reserve(2);
+    TRIAL_TEST(vector.try_push_back(11));
+    TRIAL_TEST(vector.try_push_front(22));
+    TRIAL_TEST(!vector.try_push_back(33));
+    TRIAL_TEST(!vector.try_push_front(44));
+    {
+        std::vector<int> expect = { 22, 11 };
+        TRIAL_TEST_ALL_EQ(vector.begin(), vector.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void run()
+{
+    try_push_back();
+    try_push_back_range();
+    try_push_front();
+    try_push_front_range();
+    reject_push_back();
+    reject_push_back_range();
+    reject_expand();
+    overwrite_expand();
+    vector_try_push_back();
+}
+
+} // namespace overflow_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    type_suite::run();
+    span_suite::run();
+    array_suite::run();
+    vector_suite::run();
+    evict_suite::run();
+    overflow_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,193 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/span.hpp>
+#include <trial/circular/array.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace concept_suite
+{
+
+void span_concepts()
+{
+    using span_type = circular::span<int>;
+    static_assert(std::ranges::random_access_range<span_type>);
+    static_assert(std::ranges::sized_range<span_type>);
+    static_assert(std::ranges::borrowed_range<span_type>);
+    static_assert(std::ranges::common_range<span_type>);
+    static_assert(std::ranges::random_access_range<const span_type>);
+    static_assert(std::random_access_iterator<span_type::iterator>);
+    static_assert(std::random_access_iterator<span_type::const_iterator>);
+    static_assert(std::sized_sentinel_for<span_type::iterator, span_type::iterator>);
+    static_assert(std::ranges::output_range<span_type, int>);
+}
+
+void span_fixed_concepts()
+{
+    using span_type = circular::span<int, 4>;
+    static_assert(std::ranges::random_access_range<span_type>);
+    static_assert(std::ranges::sized_range<span_type>);
+    static_assert(std::ranges::borrowed_range<span_type>);
+}
+
+void array_concepts()
+{
+    using array_type = circular::array<int, 4>;
+    static_assert(std::ranges::random_access_range<array_type>);
+    static_assert(std::ranges::sized_range<array_type>);
+    static_assert(!std::ranges::borrowed_range<array_type>);
+}
+
+void segment_concepts()
+{
+    using segment_type = circular::span<int>::segment;
+    static_assert(std::ranges::contiguous_range<segment_type>);
+    static_assert(std::ranges::sized_range<segment_type>);
+    static_assert(std::ranges::borrowed_range<segment_type>);
+    static_assert(std::ranges::view<segment_type>);
+
+    using range_type = circular::span<int>::segment_range;
+    static_assert(std::ranges::random_access_range<range_type>);
+    static_assert(std::ranges::sized_range<range_type>);
+    static_assert(std::ranges::view<range_type>);
+}
+
+void run()
+{
+    span_concepts();
+    span_fixed_concepts();
+    array_concepts();
+    segment_concepts();
+}
+
+} // namespace concept_suite
+
+//-----------------------------------------------------------------------------
+
+namespace view_suite
+{
+
+void view_reverse()
+{
+    int array[4] = {};
+    circular::span<int> span(array);
+    span = { 11, 22, 33, 44, 55 };
+    std::vector<int> result;
+    std::ranges::copy(span | std::views::reverse, std::back_inserter(result));
+    std::vector<int> expect = { 55, 44, 33, 22 };
+    TRIAL_TEST_ALL_EQ(result.begin(), result.end(),
+                      expect.begin(), expect.end());
+}
+
+void view_transform()
+{
+    circular::array<int, 4> data = { 11, 22, 33, 44 };
+    data.push_back(55);
+    std::vector<int> result;
+    std::ranges::copy(data | std::views::transform([] (int value) { return value + 1; }),
+                      std::back_inserter(result));
+    std::vector<int> expect = { 23, 34, 45, 56 };
+    TRIAL_TEST_ALL_EQ(result.begin(), result.end(),
+                      expect.begin(), expect.end());
+}
+
+void view_join_segments()
+{
+    int array[4] = {};
+    circular::span<int> span(array);
+    span = { 11, 22, 33, 44, 55, 66 };
+    std::vector<int> result;
+    std::ranges::copy(span.segments() | std::views::join, std::back_inserter(result));
+    std::vector<int> expect = { 33, 44, 55, 66 };
+    TRIAL_TEST_ALL_EQ(result.begin(), result.end(),
+                      expect.begin(), expect.end());
+}
+
+void view_std_span_segments()
+{
+    int array[4] = {};
+    circular::span<int> span(array);
+    span = { 11, 22, 33, 44, 55, 66 };
+    std::vector<int> result;
+    for (std::span<int> segment : span.segments())
+    {
+        std::ranges::copy(segment, std::back_inserter(result));
+    }
+    std::vector<int> expect = { 33, 44, 55, 66 };
+    TRIAL_TEST_ALL_EQ(result.begin(), result.end(),
+                      expect.begin(), expect.end());
+}
+
+void run()
+{
+    view_reverse();
+    view_transform();
+    view_join_segments();
+    view_std_span_segments();
+}
+
+} // namespace view_suite
+
+//-----------------------------------------------------------------------------
+
+namespace algorithm_suite
+{
+
+void sort_overfull()
+{
+    int array[4] = {};
+    circular::span<int> span(array);
+    span = { 11, 22, 33, 44, 55, 66 };
+    std::ranges::sort(span, std::greater<>{});
+    std::vector<int> expect = { 66, 55, 44, 33 };
+    TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                      expect.begin(), expect.end());
+}
+
+void find_dangling()
+{
+    int array[4] = {};
+    circular::span<int> span(array);
+    span = { 11, 22, 33, 44, 55, 66 };
+    // Iterators outlive the temporary span
+    auto where = std::ranges::find(circular::span<int>(span), 55);
+    TRIAL_TEST_EQ(*where, 55);
+    TRIAL_TEST(where == span.begin() + 2);
+}
+
+void run()
+{
+    sort_overfull();
+    find_dangling();
+}
+
+} // namespace algorithm_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    concept_suite::run();
+    view_suite::run();
+    algorithm_suite::run();
+
+    return boost::report_errors();
+}
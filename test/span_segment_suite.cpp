@@ -2130,6 +2130,105 @@ void run()
 
 } // namespace iterator_suite
 
+//-----------------------------------------------------------------------------
+
+namespace range_suite
+{
+
+void segments_empty()
+{
+    int array[4] = {};
+    circular::span<int> span(array);
+    auto segments = span.segments();
+    TRIAL_TEST(segments.empty());
+    TRIAL_TEST_EQ(segments.size(), 0);
+    TRIAL_TEST(segments.begin() == segments.end());
+}
+
+void segments_partial()
+{
+    int array[4] = {};
+    circular::span<int> span(array);
+    span = { 11, 22 };
+    auto segments = span.segments();
+    TRIAL_TEST_EQ(segments.size(), 1);
+    TRIAL_TEST(segments.begin()->data() == span.first_segment().data());
+    {
+        std::vector<int> expect = { 11, 22 };
+        TRIAL_TEST_ALL_EQ(segments.begin()->begin(), segments.begin()->end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void segments_overfull()
+{
+    int array[4] = {};
+    circular::span<int> span(array);
+    // 55 66 33 44
+    // ----> <----
+    span = { 11, 22, 33, 44, 55, 66 };
+    auto segments = span.segments();
+    TRIAL_TEST_EQ(segments.size(), 2);
+    std::vector<int> result;
+    for (auto&& segment : segments)
+    {
+        result.insert(result.end(), segment.begin(), segment.end());
+    }
+    {
+        std::vector<int> expect = { 33, 44, 55, 66 };
+        TRIAL_TEST_ALL_EQ(result.begin(), result.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void segments_mutable()
+{
+    int array[4] = {};
+    circular::span<int> span(array);
+    span = { 11, 22, 33, 44, 55, 66 };
+    for (auto&& segment : span.segments())
+    {
+        for (auto& value : segment)
+        {
+            value += 1;
+        }
+    }
+    {
+        std::vector<int> expect = { 34, 45, 56, 67 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void segments_const()
+{
+    int array[4] = {};
+    circular::span<int> original(array);
+    original = { 11, 22, 33, 44, 55, 66 };
+    const circular::span<int> span(original);
+    std::vector<int> result;
+    for (auto&& segment : span.segments())
+    {
+        result.insert(result.end(), segment.begin(), segment.end());
+    }
+    {
+        std::vector<int> expect = { 33, 44, 55, 66 };
+        TRIAL_TEST_ALL_EQ(result.begin(), result.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void run()
+{
+    segments_empty();
+    segments_partial();
+    segments_overfull();
+    segments_mutable();
+    segments_const();
+}
+
+} // namespace range_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -2139,6 +2238,7 @@ int main()
     api_suite::run();
     data_suite::run();
     iterator_suite::run();
- 
+    range_suite::run();
+
     return boost::report_errors();
 }
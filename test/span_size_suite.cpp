@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/span.hpp>
+#include <trial/circular/array.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace type_suite
+{
+
+void type_size()
+{
+    static_assert(std::is_same<circular::span<int, 4, std::uint16_t>::size_type, std::uint16_t>::value, "");
+    static_assert(std::is_same<circular::array<int, 4, std::uint8_t>::size_type, std::uint8_t>::value, "");
+
+    // Narrow indices make spans smaller
+    static_assert(sizeof(circular::span<int, circular::dynamic_extent, std::uint16_t>) < sizeof(circular::span<int>), "");
+    static_assert(sizeof(circular::span<int, 4, std::uint16_t>) < sizeof(circular::span<int, 4>), "");
+    static_assert(sizeof(circular::span<int, circular::dynamic_extent, std::uint32_t>::iterator) < sizeof(circular::span<int>::iterator), "");
+}
+
+void run()
+{
+    type_size();
+}
+
+} // namespace type_suite
+
+//-----------------------------------------------------------------------------
+
+namespace dynamic_suite
+{
+
+void dynamic_push_back()
+{
+    int storage[4];
+    circular::span<int, circular::dynamic_extent, std::uint8_t> span(storage);
+    TRIAL_TEST_EQ(span.capacity(), 4);
+    for (int k = 1; k <= 1000; ++k)
+    {
+        span.push_back(k);
+        TRIAL_TEST_EQ(span.back(), k);
+    }
+    TRIAL_TEST_EQ(span.size(), 4);
+    {
+        std::vector<int> expect = { 997, 998, 999, 1000 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void dynamic_push_front()
+{
+    int storage[4];
+    circular::span<int, circular::dynamic_extent, std::uint8_t> span(storage);
+    for (int k = 1; k <= 1000; ++k)
+    {
+        span.push_front(k);
+        TRIAL_TEST_EQ(span.front(), k);
+    }
+    {
+        std::vector<int> expect = { 1000, 999, 998, 997 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void dynamic_largest()
+{
+    // Capacity must be less than half the maximum value of size type
+    std::vector<int> storage(126);
+    circular::span<int, circular::dynamic_extent, std::uint8_t> span(storage.begin(), storage.end());
+    TRIAL_TEST_EQ(span.capacity(), 126);
+    for (int k = 0; k < 1000; ++k)
+    {
+        span.push_back(k);
+    }
+    TRIAL_TEST_EQ(span.front(), 1000 - 126);
+    TRIAL_TEST_EQ(span.back(), 999);
+    TRIAL_TEST_EQ(span.end() - span.begin(), 126);
+    TRIAL_TEST_EQ(std::accumulate(span.begin(), span.end(), 0),
+                  (999 + 1000 - 126) * 126 / 2);
+}
+
+void run()
+{
+    dynamic_push_back();
+    dynamic_push_front();
+    dynamic_largest();
+}
+
+} // namespace dynamic_suite
+
+//-----------------------------------------------------------------------------
+
+namespace fixed_suite
+{
+
+void fixed_iterator()
+{
+    int storage[5];
+    circular::span<int, 5, std::uint16_t> span(storage);
+    for (int k = 1; k <= 7; ++k)
+    {
+        span.push_back(k);
+    }
+    auto it = span.begin();
+    TRIAL_TEST_EQ(*it, 3);
+    it += 4;
+    TRIAL_TEST_EQ(*it, 7);
+    --it;
+    TRIAL_TEST_EQ(*it, 6);
+    TRIAL_TEST_EQ(it - span.begin(), 3);
+    TRIAL_TEST_EQ(span.begin()[2], 5);
+    TRIAL_TEST(span.begin() + 5 == span.end());
+}
+
+void fixed_segments()
+{
+    int storage[5];
+    circular::span<int, 5, std::uint16_t> span(storage);
+    for (int k = 1; k <= 7; ++k)
+    {
+        span.push_back(k);
+    }
+    TRIAL_TEST_EQ(span.first_segment().size(), 3);
+    TRIAL_TEST_EQ(span.last_segment().size(), 2);
+    span.remove_front(2);
+    TRIAL_TEST_EQ(span.first_segment().size(), 1);
+    TRIAL_TEST_EQ(span.first_unused_segment().size(), 2);
+}
+
+void fixed_array()
+{
+    circular::array<int, 4, std::uint8_t> array = { 1, 2, 3, 4 };
+    array.push_back(5);
+    circular::array<int, 4, std::uint8_t> copy(array);
+    {
+        std::vector<int> expect = { 2, 3, 4, 5 };
+        TRIAL_TEST_ALL_EQ(copy.begin(), copy.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void run()
+{
+    fixed_iterator();
+    fixed_segments();
+    fixed_array();
+}
+
+} // namespace fixed_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    type_suite::run();
+    dynamic_suite::run();
+    fixed_suite::run();
+
+    return boost::report_errors();
+}
@@ -9,6 +9,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <array>
+#include <deque>
+#include <string>
 #include <vector>
 #include <trial/detail/lightweight_test.hpp>
 #include <trial/circular/span.hpp>
@@ -3866,6 +3868,225 @@ void run()
 
 } // namespace normalize_suite
 
+//-----------------------------------------------------------------------------
+
+namespace erase_suite
+{
+
+void erase_front()
+{
+    std::array<int, 4> array = {};
+    circular::span<int> span(array.begin(), array.end());
+    span = { 11, 22, 33 };
+    auto where = span.erase(span.begin());
+    TRIAL_TEST(where == span.begin());
+    TRIAL_TEST_EQ(*where, 22);
+    {
+        std::vector<int> expect = { 22, 33 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void erase_back()
+{
+    std::array<int, 4> array = {};
+    circular::span<int> span(array.begin(), array.end());
+    span = { 11, 22, 33 };
+    auto where = span.erase(span.begin() + 2);
+    TRIAL_TEST(where == span.end());
+    {
+        std::vector<int> expect = { 11, 22 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void erase_middle_wrapped()
+{
+    std::array<int, 5> array = {};
+    circular::span<int> span(array.begin(), array.end());
+    span = { 11, 22, 33, 44, 55 };
+    span.push_back(66);
+    span.push_back(77);
+    // Storage: [66][77][33][44][55]
+    auto where = span.erase(span.begin() + 3);
+    TRIAL_TEST_EQ(*where, 77);
+    {
+        std::vector<int> expect = { 33, 44, 55, 77 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+    where = span.erase(span.begin() + 1);
+    TRIAL_TEST_EQ(*where, 55);
+    {
+        std::vector<int> expect = { 33, 55, 77 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void erase_range()
+{
+    std::array<int, 5> array = {};
+    circular::span<int> span(array.begin(), array.end());
+    span = { 11, 22, 33, 44, 55 };
+    span.push_back(66);
+    auto where = span.erase(span.begin() + 1, span.begin() + 3);
+    TRIAL_TEST_EQ(*where, 55);
+    {
+        std::vector<int> expect = { 22, 55, 66 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+    where = span.erase(span.begin(), span.begin());
+    TRIAL_TEST(where == span.begin());
+    TRIAL_TEST_EQ(span.size(), 3);
+    where = span.erase(span.begin(), span.end());
+    TRIAL_TEST(where == span.end());
+    TRIAL_TEST(span.empty());
+}
+
+// Compare with std::deque for every position and rotation
+
+template <typename T>
+void erase_exhaustive(T (*make)(int))
+{
+    const int capacity = 7;
+    for (int rotation = 0; rotation < capacity; ++rotation)
+    {
+        for (int first = 0; first < capacity; ++first)
+        {
+            for (int last = first; last <= capacity; ++last)
+            {
+                std::vector<T> array(capacity);
+                circular::span<T> span(array.begin(), array.end());
+                std::deque<T> expect;
+                for (int k = 0; k < capacity + rotation; ++k)
+                {
+                    span.push_back(make(k));
+                    expect.push_back(make(k));
+                    if (int(expect.size()) > capacity)
+                        expect.pop_front();
+                }
+                auto where = span.erase(span.begin() + first, span.begin() + last);
+                expect.erase(expect.begin() + first, expect.begin() + last);
+                TRIAL_TEST_EQ(where - span.begin(), first);
+                TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                                  expect.begin(), expect.end());
+            }
+        }
+    }
+}
+
+int make_int(int k) { return k; }
+std::string make_string(int k) { return std::string(24, char('a' + k)); }
+
+void run()
+{
+    erase_front();
+    erase_back();
+    erase_middle_wrapped();
+    erase_range();
+    erase_exhaustive<int>(make_int);
+    erase_exhaustive<std::string>(make_string);
+}
+
+} // namespace erase_suite
+
+//-----------------------------------------------------------------------------
+
+namespace insert_suite
+{
+
+void insert_front()
+{
+    std::array<int, 4> array = {};
+    circular::span<int> span(array.begin(), array.end());
+    span = { 11, 22, 33 };
+    auto where = span.insert(span.begin(), 44);
+    TRIAL_TEST(where == span.begin());
+    {
+        std::vector<int> expect = { 44, 11, 22, 33 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void insert_back()
+{
+    std::array<int, 4> array = {};
+    circular::span<int> span(array.begin(), array.end());
+    span = { 11, 22, 33 };
+    auto where = span.insert(span.end(), 44);
+    TRIAL_TEST_EQ(*where, 44);
+    {
+        std::vector<int> expect = { 11, 22, 33, 44 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void insert_middle()
+{
+    std::array<int, 4> array = {};
+    circular::span<int> span(array.begin(), array.end());
+    span = { 11, 22 };
+    auto where = span.insert(span.begin() + 1, 33);
+    TRIAL_TEST_EQ(*where, 33);
+    where = span.insert(span.begin() + 2, 44);
+    TRIAL_TEST_EQ(*where, 44);
+    {
+        std::vector<int> expect = { 11, 33, 44, 22 };
+        TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+template <typename T>
+void insert_exhaustive(T (*make)(int))
+{
+    const int capacity = 7;
+    for (int rotation = 0; rotation < capacity; ++rotation)
+    {
+        for (int size = 0; size < capacity; ++size)
+        {
+            for (int position = 0; position <= size; ++position)
+            {
+                std::vector<T> array(capacity);
+                circular::span<T> span(array.begin(), array.end());
+                std::deque<T> expect;
+                for (int k = 0; k < rotation; ++k)
+                {
+                    span.push_back(make(k));
+                    span.pop_front();
+                }
+                for (int k = 0; k < size; ++k)
+                {
+                    span.push_back(make(k));
+                    expect.push_back(make(k));
+                }
+                auto where = span.insert(span.begin() + position, make(capacity));
+                expect.insert(expect.begin() + position, make(capacity));
+                TRIAL_TEST_EQ(where - span.begin(), position);
+                TRIAL_TEST_ALL_EQ(span.begin(), span.end(),
+                                  expect.begin(), expect.end());
+            }
+        }
+    }
+}
+
+void run()
+{
+    insert_front();
+    insert_back();
+    insert_middle();
+    insert_exhaustive<int>(erase_suite::make_int);
+    insert_exhaustive<std::string>(erase_suite::make_string);
+}
+
+} // namespace insert_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -3883,6 +4104,8 @@ int main()
     window_size_suite::run();
     expand_suite::run();
     normalize_suite::run();
+    erase_suite::run();
+    insert_suite::run();
  
     return boost::report_errors();
 }
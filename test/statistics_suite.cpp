@@ -0,0 +1,191 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/detail/functional.hpp>
+#include <trial/circular/statistics.hpp>
+
+using namespace trial;
+
+namespace
+{
+
+// Exact statistics with long double as reference
+
+struct reference
+{
+    template <typename Iterator>
+    reference(Iterator first, Iterator last)
+    {
+        long double total = 0;
+        std::size_t count = 0;
+        for (auto it = first; it != last; ++it, ++count)
+            total += *it;
+        mean = total / count;
+        long double squares = 0;
+        for (auto it = first; it != last; ++it)
+            squares += (*it - mean) * (*it - mean);
+        variance = squares / count;
+    }
+
+    long double mean;
+    long double variance;
+};
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void api_empty()
+{
+    circular::statistics<double, 4> window;
+    TRIAL_TEST(window.empty());
+    TRIAL_TEST_EQ(window.capacity(), 4);
+    TRIAL_TEST_EQ(window.sum(), 0.0);
+}
+
+void api_dynamic()
+{
+    circular::statistics<double> window(4);
+    TRIAL_TEST(window.empty());
+    TRIAL_TEST_EQ(window.capacity(), 4);
+}
+
+void api_partial()
+{
+    circular::statistics<double, 4> window;
+    window.push(1.0);
+    TRIAL_TEST_EQ(window.mean(), 1.0);
+    TRIAL_TEST_EQ(window.variance(), 0.0);
+    window.push(3.0);
+    TRIAL_TEST_EQ(window.sum(), 4.0);
+    TRIAL_TEST_EQ(window.mean(), 2.0);
+    TRIAL_TEST_EQ(window.variance(), 1.0);
+    TRIAL_TEST_EQ(window.unbiased_variance(), 2.0);
+    TRIAL_TEST_EQ(window.standard_deviation(), 1.0);
+}
+
+void api_overfull()
+{
+    circular::statistics<double, 2> window;
+    window.push(100.0);
+    window.push(1.0);
+    window.push(3.0);
+    TRIAL_TEST_EQ(window.size(), 2);
+    TRIAL_TEST_EQ(window.sum(), 4.0);
+    TRIAL_TEST_EQ(window.mean(), 2.0);
+    TRIAL_TEST_EQ(window.variance(), 1.0);
+    std::vector<double> expect = { 1.0, 3.0 };
+    TRIAL_TEST_ALL_EQ(window.begin(), window.end(), expect.begin(), expect.end());
+}
+
+void api_clear()
+{
+    circular::statistics<double> window(2);
+    window.push(1.0);
+    window.push(3.0);
+    window.clear();
+    TRIAL_TEST(window.empty());
+    window.push(5.0);
+    TRIAL_TEST_EQ(window.mean(), 5.0);
+    TRIAL_TEST_EQ(window.variance(), 0.0);
+}
+
+void run()
+{
+    api_empty();
+    api_dynamic();
+    api_partial();
+    api_overfull();
+    api_clear();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace accuracy_suite
+{
+
+template <typename Window>
+void compare_reference(Window& window, double offset, double scale)
+{
+    std::mt19937 generator(42);
+    std::normal_distribution<double> distribution(offset, scale);
+    std::vector<double> history;
+    for (int k = 0; k < 100000; ++k)
+    {
+        const double value = distribution(generator);
+        window.push(value);
+        history.push_back(value);
+    }
+    reference expect(history.end() - window.size(), history.end());
+    TRIAL_TEST_WITH(window.mean(), double(expect.mean), detail::close_to<double>(1e-12));
+    TRIAL_TEST_WITH(window.variance(), double(expect.variance), detail::close_to<double>(1e-6));
+}
+
+void large_offset_fixed()
+{
+    circular::statistics<double, 1000> window;
+    compare_reference(window, 1e9, 1.0);
+}
+
+void large_offset_dynamic()
+{
+    circular::statistics<double> window(999);
+    compare_reference(window, 1e9, 1.0);
+}
+
+void mixed_magnitude()
+{
+    circular::statistics<double, 16> window;
+    for (int k = 0; k < 1000; ++k)
+    {
+        window.push(1e16);
+        window.push(1.0);
+        window.push(-1e16);
+    }
+    for (int k = 0; k < 16; ++k)
+    {
+        window.push(1.0);
+    }
+    TRIAL_TEST_EQ(window.sum(), 16.0);
+    TRIAL_TEST_EQ(window.mean(), 1.0);
+    window.recalculate();
+    TRIAL_TEST_EQ(window.sum(), 16.0);
+    TRIAL_TEST_EQ(window.variance(), 0.0);
+}
+
+void run()
+{
+    large_offset_fixed();
+    large_offset_dynamic();
+    mixed_magnitude();
+}
+
+} // namespace accuracy_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    accuracy_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,205 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/timed_ring.hpp>
+
+using namespace trial;
+
+namespace
+{
+
+// Manual clock for deterministic timestamps
+
+struct manual_clock
+{
+    using duration = std::chrono::seconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<manual_clock>;
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept { return current; }
+
+    static time_point current;
+};
+
+manual_clock::time_point manual_clock::current;
+
+manual_clock::time_point at(int seconds)
+{
+    return manual_clock::time_point(std::chrono::seconds(seconds));
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void api_empty()
+{
+    circular::timed_ring<int, manual_clock> ring(4);
+    TRIAL_TEST(ring.empty());
+    TRIAL_TEST(!ring.full());
+    TRIAL_TEST_EQ(ring.size(), 0);
+    TRIAL_TEST_EQ(ring.capacity(), 4);
+    TRIAL_TEST_EQ(ring.expire(at(10)), 0);
+}
+
+void api_push()
+{
+    circular::timed_ring<int, manual_clock> ring(4);
+    ring.push(at(1), 11);
+    ring.push(at(2), 22);
+    TRIAL_TEST_EQ(ring.size(), 2);
+    TRIAL_TEST_EQ(ring.front(), 11);
+    TRIAL_TEST_EQ(ring.back(), 22);
+    TRIAL_TEST(ring.front_time() == at(1));
+    TRIAL_TEST(ring.back_time() == at(2));
+}
+
+void api_push_now()
+{
+    circular::timed_ring<int, manual_clock> ring(4);
+    manual_clock::current = at(5);
+    ring.push(55);
+    TRIAL_TEST(ring.back_time() == at(5));
+    TRIAL_TEST_EQ(ring.back(), 55);
+}
+
+void api_push_overflow()
+{
+    circular::timed_ring<int, manual_clock> ring(2);
+    ring.push(at(1), 11);
+    ring.push(at(2), 22);
+    ring.push(at(3), 33);
+    TRIAL_TEST(ring.full());
+    TRIAL_TEST(ring.front_time() == at(2));
+    {
+        std::vector<int> expect = { 22, 33 };
+        TRIAL_TEST_ALL_EQ(ring.begin(), ring.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void api_clear()
+{
+    circular::timed_ring<int, manual_clock> ring(2);
+    ring.push(at(1), 11);
+    ring.clear();
+    TRIAL_TEST(ring.empty());
+    TRIAL_TEST(ring.timestamps().empty());
+}
+
+void run()
+{
+    api_empty();
+    api_push();
+    api_push_now();
+    api_push_overflow();
+    api_clear();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace expire_suite
+{
+
+void expire_none()
+{
+    circular::timed_ring<int, manual_clock> ring(4);
+    ring.push(at(10), 1);
+    ring.push(at(20), 2);
+    TRIAL_TEST_EQ(ring.expire(at(10)), 0);
+    TRIAL_TEST_EQ(ring.size(), 2);
+}
+
+void expire_some()
+{
+    circular::timed_ring<int, manual_clock> ring(4);
+    ring.push(at(10), 1);
+    ring.push(at(20), 2);
+    ring.push(at(30), 3);
+    TRIAL_TEST_EQ(ring.expire(at(15)), 1);
+    TRIAL_TEST_EQ(ring.front(), 2);
+    TRIAL_TEST_EQ(ring.expire(at(20)), 0);
+    TRIAL_TEST_EQ(ring.expire(at(21)), 1);
+    TRIAL_TEST_EQ(ring.front(), 3);
+}
+
+void expire_all()
+{
+    circular::timed_ring<int, manual_clock> ring(4);
+    ring.push(at(10), 1);
+    ring.push(at(20), 2);
+    TRIAL_TEST_EQ(ring.expire(at(100)), 2);
+    TRIAL_TEST(ring.empty());
+}
+
+void expire_duplicates()
+{
+    circular::timed_ring<int, manual_clock> ring(4);
+    ring.push(at(10), 1);
+    ring.push(at(10), 2);
+    ring.push(at(20), 3);
+    TRIAL_TEST_EQ(ring.expire(at(11)), 2);
+    TRIAL_TEST_EQ(ring.front(), 3);
+}
+
+void expire_wraparound()
+{
+    // Expire at every position with wrapped storage
+    for (int cutoff = 0; cutoff < 10; ++cutoff)
+    {
+        circular::timed_ring<int, manual_clock> ring(5);
+        for (int k = 0; k < 8; ++k)
+        {
+            ring.push(at(k), k);
+        }
+        // Contains timestamps 3, 4, 5, 6, 7 in two segments
+        const int expect = (cutoff <= 3) ? 0 : ((cutoff >= 8) ? 5 : cutoff - 3);
+        TRIAL_TEST_EQ(ring.expire(at(cutoff)), expect);
+        TRIAL_TEST_EQ(ring.size(), 5 - expect);
+        TRIAL_TEST_EQ(ring.timestamps().size(), ring.size());
+        if (!ring.empty())
+        {
+            TRIAL_TEST_EQ(ring.front(), 3 + expect);
+        }
+    }
+}
+
+void run()
+{
+    expire_none();
+    expire_some();
+    expire_all();
+    expire_duplicates();
+    expire_wraparound();
+}
+
+} // namespace expire_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    expire_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <numeric>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/vector.hpp>
+#include <trial/circular/algorithm.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+constexpr int push_back()
+{
+    circular::vector<int> data(4);
+    for (int k = 1; k <= 6; ++k)
+    {
+        data.push_back(k);
+    }
+    return std::accumulate(data.begin(), data.end(), 0);
+}
+
+void api_push_back()
+{
+    static_assert(push_back() == 3 + 4 + 5 + 6, "");
+}
+
+constexpr int push_front()
+{
+    circular::vector<int> data(3);
+    data.reserve(4);
+    data.push_front(1);
+    data.push_front(2);
+    data.push_front(3);
+    // Grows into spare capacity
+    data.push_front(4);
+    return 10 * int(data.size()) + data.front();
+}
+
+void api_push_front()
+{
+    static_assert(push_front() == 44, "");
+}
+
+constexpr int resize()
+{
+    circular::vector<int> data = { 1, 2, 3, 4 };
+    data.push_back(5);
+    data.resize(6, 9);
+    return 10 * data.front() + data.back();
+}
+
+void api_resize()
+{
+    static_assert(resize() == 29, "");
+}
+
+constexpr int copy()
+{
+    circular::vector<int> empty;
+    circular::vector<int> copy(empty);
+    circular::vector<int> data = { 1, 2, 3 };
+    copy = data;
+    data.clear();
+    return int(data.size()) + copy.back();
+}
+
+void api_copy()
+{
+    static_assert(copy() == 3, "");
+}
+
+constexpr int search()
+{
+    circular::vector<int> data = { 10, 20, 30, 40 };
+    data.push_back(50);
+    return *circular::lower_bound(data, 35);
+}
+
+void api_search()
+{
+    static_assert(search() == 40, "");
+}
+
+void run()
+{
+    api_push_back();
+    api_push_front();
+    api_resize();
+    api_copy();
+    api_search();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+
+    return boost::report_errors();
+}
@@ -9,6 +9,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <memory>
+#include <vector>
 #include <trial/detail/lightweight_test.hpp>
 #include <trial/circular/vector.hpp>
 
@@ -1639,6 +1640,105 @@ void run()
 
 } // namespace allocator_suite
 
+//-----------------------------------------------------------------------------
+
+namespace insert_suite
+{
+
+void insert_middle()
+{
+    circular::vector<int> data(4);
+    data = { 11, 22, 33 };
+    auto where = data.insert(data.begin() + 1, 44);
+    TRIAL_TEST_EQ(*where, 44);
+    {
+        std::vector<int> expect = { 11, 44, 22, 33 };
+        TRIAL_TEST_ALL_EQ(data.begin(), data.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void insert_spare_capacity()
+{
+    circular::vector<int> data(3);
+    data = { 11, 22, 33 };
+    data.reserve(8);
+    data.pop_front();
+    data.push_back(44);
+    // Storage: [44][22][33]
+    auto where = data.insert(data.begin() + 1, 55);
+    TRIAL_TEST_EQ(*where, 55);
+    TRIAL_TEST_EQ(data.capacity(), 8);
+    {
+        std::vector<int> expect = { 22, 55, 33, 44 };
+        TRIAL_TEST_ALL_EQ(data.begin(), data.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void insert_spare_capacity_sides()
+{
+    // Insert at every position of a wrapped full vector with spare capacity
+    for (int offset = 0; offset <= 5; ++offset)
+    {
+        circular::vector<int> data(5);
+        data = { 11, 22, 33, 44, 55 };
+        data.reserve(8);
+        data.pop_front();
+        data.pop_front();
+        data.push_back(66);
+        data.push_back(77);
+        // Storage: [66][77][33][44][55]
+        auto where = data.insert(data.begin() + offset, 88);
+        TRIAL_TEST_EQ(*where, 88);
+        TRIAL_TEST_EQ(data.size(), 6);
+        TRIAL_TEST_EQ(data.capacity(), 8);
+        std::vector<int> expect = { 33, 44, 55, 66, 77 };
+        expect.insert(expect.begin() + offset, 88);
+        TRIAL_TEST_ALL_EQ(data.begin(), data.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void push_back_spare_capacity_wrapped()
+{
+    circular::vector<int> data(3);
+    data = { 11, 22, 33 };
+    data.reserve(8);
+    data.pop_front();
+    data.push_back(44);
+    data.push_back(55);
+    {
+        std::vector<int> expect = { 22, 33, 44, 55 };
+        TRIAL_TEST_ALL_EQ(data.begin(), data.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void erase_middle()
+{
+    circular::vector<int> data(4);
+    data = { 11, 22, 33, 44 };
+    auto where = data.erase(data.begin() + 2);
+    TRIAL_TEST_EQ(*where, 44);
+    {
+        std::vector<int> expect = { 11, 22, 44 };
+        TRIAL_TEST_ALL_EQ(data.begin(), data.end(),
+                          expect.begin(), expect.end());
+    }
+}
+
+void run()
+{
+    insert_middle();
+    insert_spare_capacity();
+    insert_spare_capacity_sides();
+    push_back_spare_capacity_wrapped();
+    erase_middle();
+}
+
+} // namespace insert_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -1650,6 +1750,7 @@ int main()
     move_suite::run();
     capacity_suite::run();
     allocator_suite::run();
+    insert_suite::run();
 
     return boost::report_errors();
 }
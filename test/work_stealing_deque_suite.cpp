@@ -0,0 +1,237 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <trial/detail/lightweight_test.hpp>
+#include <trial/circular/work_stealing_deque.hpp>
+
+using namespace trial;
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void api_empty()
+{
+    circular::work_stealing_deque<int> deque(4);
+    TRIAL_TEST(deque.empty());
+    TRIAL_TEST_EQ(deque.size(), 0);
+    TRIAL_TEST_EQ(deque.capacity(), 4);
+    int output = 0;
+    TRIAL_TEST(!deque.try_pop_back(output));
+    TRIAL_TEST(!deque.try_steal_front(output));
+    TRIAL_TEST(deque.empty());
+}
+
+void api_capacity_rounded()
+{
+    circular::work_stealing_deque<int> deque(5);
+    TRIAL_TEST_EQ(deque.capacity(), 8);
+}
+
+void api_pop_back()
+{
+    circular::work_stealing_deque<int> deque(4);
+    deque.push_back(11);
+    deque.push_back(22);
+    deque.push_back(33);
+    TRIAL_TEST_EQ(deque.size(), 3);
+    int output = 0;
+    TRIAL_TEST(deque.try_pop_back(output));
+    TRIAL_TEST_EQ(output, 33);
+    TRIAL_TEST(deque.try_pop_back(output));
+    TRIAL_TEST_EQ(output, 22);
+    TRIAL_TEST(deque.try_pop_back(output));
+    TRIAL_TEST_EQ(output, 11);
+    TRIAL_TEST(!deque.try_pop_back(output));
+    TRIAL_TEST(deque.empty());
+}
+
+void api_steal_front()
+{
+    circular::work_stealing_deque<int> deque(4);
+    deque.push_back(11);
+    deque.push_back(22);
+    deque.push_back(33);
+    int output = 0;
+    TRIAL_TEST(deque.try_steal_front(output));
+    TRIAL_TEST_EQ(output, 11);
+    TRIAL_TEST(deque.try_steal_front(output));
+    TRIAL_TEST_EQ(output, 22);
+    TRIAL_TEST(deque.try_steal_front(output));
+    TRIAL_TEST_EQ(output, 33);
+    TRIAL_TEST(!deque.try_steal_front(output));
+    TRIAL_TEST(deque.empty());
+}
+
+void api_mixed()
+{
+    circular::work_stealing_deque<int> deque(4);
+    deque.push_back(11);
+    deque.push_back(22);
+    int output = 0;
+    TRIAL_TEST(deque.try_steal_front(output));
+    TRIAL_TEST_EQ(output, 11);
+    deque.push_back(33);
+    TRIAL_TEST(deque.try_pop_back(output));
+    TRIAL_TEST_EQ(output, 33);
+    TRIAL_TEST(deque.try_pop_back(output));
+    TRIAL_TEST_EQ(output, 22);
+    TRIAL_TEST(!deque.try_steal_front(output));
+}
+
+void run()
+{
+    api_empty();
+    api_capacity_rounded();
+    api_pop_back();
+    api_steal_front();
+    api_mixed();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace grow_suite
+{
+
+void grow_linear()
+{
+    circular::work_stealing_deque<int> deque(2);
+    for (int k = 0; k < 5; ++k)
+        deque.push_back(k);
+    TRIAL_TEST_EQ(deque.size(), 5);
+    TRIAL_TEST_EQ(deque.capacity(), 8);
+    int output = 0;
+    for (int k = 0; k < 5; ++k)
+    {
+        TRIAL_TEST(deque.try_steal_front(output));
+        TRIAL_TEST_EQ(output, k);
+    }
+    TRIAL_TEST(deque.empty());
+}
+
+void grow_wraparound()
+{
+    // Grow while elements span both segments of the buffer
+    circular::work_stealing_deque<int> deque(4);
+    int output = 0;
+    deque.push_back(0);
+    deque.push_back(1);
+    deque.push_back(2);
+    TRIAL_TEST(deque.try_steal_front(output));
+    TRIAL_TEST(deque.try_steal_front(output));
+    deque.push_back(3);
+    deque.push_back(4);
+    deque.push_back(5);
+    TRIAL_TEST_EQ(deque.capacity(), 4);
+    deque.push_back(6);
+    TRIAL_TEST_EQ(deque.capacity(), 8);
+    TRIAL_TEST_EQ(deque.size(), 5);
+    for (int k = 2; k < 7; ++k)
+    {
+        TRIAL_TEST(deque.try_steal_front(output));
+        TRIAL_TEST_EQ(output, k);
+    }
+    TRIAL_TEST(deque.empty());
+}
+
+void run()
+{
+    grow_linear();
+    grow_wraparound();
+}
+
+} // namespace grow_suite
+
+//-----------------------------------------------------------------------------
+
+namespace concurrent_suite
+{
+
+// Owner pushes and pops while thieves steal. Every element must be taken
+// exactly once.
+
+void concurrent_steal()
+{
+    const int amount = 100000;
+    const int thieves = 3;
+
+    circular::work_stealing_deque<int> deque(4);
+    std::vector<std::atomic<int>> taken(amount);
+    for (auto& entry : taken)
+        entry.store(0);
+    std::atomic<bool> done(false);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thieves; ++t)
+    {
+        threads.emplace_back([&deque, &taken, &done] {
+            int output = 0;
+            while (!done.load())
+            {
+                if (deque.try_steal_front(output))
+                    taken[output].fetch_add(1);
+            }
+            while (deque.try_steal_front(output))
+                taken[output].fetch_add(1);
+        });
+    }
+
+    int output = 0;
+    for (int k = 0; k < amount; ++k)
+    {
+        deque.push_back(k);
+        if ((k % 3 == 0) && deque.try_pop_back(output))
+            taken[output].fetch_add(1);
+    }
+    while (!deque.empty())
+    {
+        if (deque.try_pop_back(output))
+            taken[output].fetch_add(1);
+    }
+    done.store(true);
+    for (auto& thread : threads)
+        thread.join();
+
+    int missing = 0;
+    int duplicates = 0;
+    for (const auto& entry : taken)
+    {
+        missing += (entry.load() == 0);
+        duplicates += (entry.load() > 1);
+    }
+    TRIAL_TEST_EQ(missing, 0);
+    TRIAL_TEST_EQ(duplicates, 0);
+}
+
+void run()
+{
+    concurrent_steal();
+}
+
+} // namespace concurrent_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    grow_suite::run();
+    concurrent_suite::run();
+
+    return boost::report_errors();
+}